@@ -0,0 +1,117 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_a002.h"
+#include "test_data.h"
+
+/* Iterations per challenge size, can be tuned by the platform in pal_config.h */
+#ifndef ARCH_TEST_ATTEST_PARSE_ITERATIONS
+#define ARCH_TEST_ATTEST_PARSE_ITERATIONS   1000
+#endif
+#ifndef ARCH_TEST_ATTEST_VERIFY_ITERATIONS
+#define ARCH_TEST_ATTEST_VERIFY_ITERATIONS  20
+#endif
+
+const client_test_t test_a002_attestation_list[] = {
+    NULL,
+    psa_initial_attestation_parse_benchmark,
+    NULL,
+};
+
+static int         g_test_count = 1;
+
+static uint64_t parse_timestamp(void)
+{
+    uint64_t timestamp = 0;
+
+    if (val->get_timestamp(&timestamp) != VAL_STATUS_SUCCESS)
+        timestamp = 0;
+    return timestamp;
+}
+
+static int32_t parse_ns_to_print(uint64_t ns)
+{
+    return (ns > INT_MAX) ? INT_MAX : (int32_t)ns;
+}
+
+int32_t psa_initial_attestation_parse_benchmark(caller_security_t caller __UNUSED)
+{
+    int         i, num_checks = sizeof(check1)/sizeof(check1[0]);
+    int32_t     status;
+    uint32_t    iter;
+    size_t      challenge_size, token_size;
+    uint64_t    start, parse_ns, verify_ns;
+    uint8_t     challenge[PSA_INITIAL_ATTEST_CHALLENGE_SIZE_64];
+    uint8_t     token_buffer[PSA_INITIAL_ATTEST_MAX_TOKEN_SIZE];
+
+    if (val->get_timestamp(&start) != VAL_STATUS_SUCCESS)
+        val->print(PRINT_TEST, "[Info] No platform timestamp, latencies are reported as 0\n", 0);
+
+    val->print(PRINT_TEST, "[Info] Parse iterations %d", ARCH_TEST_ATTEST_PARSE_ITERATIONS);
+    val->print(PRINT_TEST, ", verify iterations %d\n", ARCH_TEST_ATTEST_VERIFY_ITERATIONS);
+    val->print(PRINT_TEST, "[Series] challenge_size,token_size,parse_ns,verify_ns,parse_permille\n", 0);
+
+    for (i = 0; i < num_checks; i++)
+    {
+        challenge_size = check1[i].challenge_size;
+
+        val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+        val->print(PRINT_TEST, check1[i].test_desc, 0);
+
+        memset(challenge, 0x2a, sizeof(challenge));
+        status = val->attestation_function(VAL_INITIAL_ATTEST_GET_TOKEN, challenge,
+                     challenge_size, token_buffer, sizeof(token_buffer), &token_size);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+        /* Both paths must agree on the token before they are timed */
+        status = val->attestation_function(VAL_INITIAL_ATTEST_VERIFY_TOKEN, challenge,
+                    challenge_size, token_buffer, token_size);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+        status = val->attestation_function(VAL_INITIAL_ATTEST_PARSE_TOKEN, challenge,
+                    challenge_size, token_buffer, token_size);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        start = parse_timestamp();
+        for (iter = 0; iter < ARCH_TEST_ATTEST_PARSE_ITERATIONS; iter++)
+        {
+            status = val->attestation_function(VAL_INITIAL_ATTEST_PARSE_TOKEN, challenge,
+                        challenge_size, token_buffer, token_size);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(4));
+        }
+        parse_ns = (parse_timestamp() - start) / ARCH_TEST_ATTEST_PARSE_ITERATIONS;
+
+        start = parse_timestamp();
+        for (iter = 0; iter < ARCH_TEST_ATTEST_VERIFY_ITERATIONS; iter++)
+        {
+            status = val->attestation_function(VAL_INITIAL_ATTEST_VERIFY_TOKEN, challenge,
+                        challenge_size, token_buffer, token_size);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(5));
+        }
+        verify_ns = (parse_timestamp() - start) / ARCH_TEST_ATTEST_VERIFY_ITERATIONS;
+
+        val->print(PRINT_TEST, "[Series] %d,", (int32_t)challenge_size);
+        val->print(PRINT_TEST, "%d,", (int32_t)token_size);
+        val->print(PRINT_TEST, "%d,", parse_ns_to_print(parse_ns));
+        val->print(PRINT_TEST, "%d,", parse_ns_to_print(verify_ns));
+        val->print(PRINT_TEST, "%d\n", verify_ns ? (int32_t)((parse_ns * 1000) / verify_ns) : 0);
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
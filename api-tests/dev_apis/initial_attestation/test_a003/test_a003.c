@@ -0,0 +1,164 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_a003.h"
+#include "test_data.h"
+
+/* Token requests per challenge size, can be tuned by the platform in pal_config.h */
+#ifndef ARCH_TEST_ATTEST_TOKEN_ITERATIONS
+#define ARCH_TEST_ATTEST_TOKEN_ITERATIONS   100
+#endif
+
+const client_test_t test_a003_attestation_list[] = {
+    NULL,
+    psa_initial_attestation_token_benchmark,
+    NULL,
+};
+
+static int         g_test_count = 1;
+static uint32_t    size_latency_ns[ARCH_TEST_ATTEST_TOKEN_ITERATIONS];
+static uint32_t    token_latency_ns[ARCH_TEST_ATTEST_TOKEN_ITERATIONS];
+
+static uint64_t token_timestamp(void)
+{
+    uint64_t timestamp = 0;
+
+    if (val->get_timestamp(&timestamp) != VAL_STATUS_SUCCESS)
+        timestamp = 0;
+    return timestamp;
+}
+
+static uint32_t token_elapsed(uint64_t start)
+{
+    uint64_t elapsed = token_timestamp() - start;
+
+    return (elapsed > UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsed;
+}
+
+static int32_t token_ns_to_print(uint64_t ns)
+{
+    return (ns > INT_MAX) ? INT_MAX : (int32_t)ns;
+}
+
+/* Shell sort, the latencies are only ordered to read the percentiles */
+static void token_sort(uint32_t *data, uint32_t count)
+{
+    uint32_t gap, i, j, value;
+
+    for (gap = count / 2; gap > 0; gap /= 2)
+    {
+        for (i = gap; i < count; i++)
+        {
+            value = data[i];
+            for (j = i; (j >= gap) && (data[j - gap] > value); j -= gap)
+                data[j] = data[j - gap];
+            data[j] = value;
+        }
+    }
+}
+
+int32_t psa_initial_attestation_token_benchmark(caller_security_t caller __UNUSED)
+{
+    int         i, num_checks = sizeof(check1)/sizeof(check1[0]);
+    int32_t     status;
+    uint32_t    iter;
+    uint32_t    p50 = ARCH_TEST_ATTEST_TOKEN_ITERATIONS / 2;
+    uint32_t    p99 = (ARCH_TEST_ATTEST_TOKEN_ITERATIONS * 99) / 100;
+    size_t      challenge_size, token_buffer_size, token_size;
+    size_t      token_size_min, token_size_max;
+    uint64_t    start, token_total_ns;
+    uint8_t     challenge[PSA_INITIAL_ATTEST_CHALLENGE_SIZE_64];
+    uint8_t     token_buffer[PSA_INITIAL_ATTEST_MAX_TOKEN_SIZE];
+
+    if (val->get_timestamp(&start) != VAL_STATUS_SUCCESS)
+        val->print(PRINT_TEST, "[Info] No platform timestamp, latencies are reported as 0\n", 0);
+
+    val->print(PRINT_TEST, "[Info] Token requests per challenge size %d\n",
+               ARCH_TEST_ATTEST_TOKEN_ITERATIONS);
+    val->print(PRINT_TEST, "[Series] challenge_size,token_size_min,token_size_max,"
+               "size_p50_ns,size_p99_ns,token_avg_ns,token_p50_ns,token_p99_ns,token_max_ns,"
+               "tokens_per_sec\n", 0);
+
+    for (i = 0; i < num_checks; i++)
+    {
+        challenge_size = check1[i].challenge_size;
+        token_size_min = SIZE_MAX;
+        token_size_max = 0;
+        token_total_ns = 0;
+
+        val->print(PRINT_TEST, "[Check %d] ", g_test_count++);
+        val->print(PRINT_TEST, check1[i].test_desc, 0);
+
+        for (iter = 0; iter < ARCH_TEST_ATTEST_TOKEN_ITERATIONS; iter++)
+        {
+            /* A fresh challenge per request, as an onboarding server would send */
+            memset(challenge, (uint8_t)iter, sizeof(challenge));
+
+            /* The size query alone, then the generation alone */
+            start = token_timestamp();
+            status = val->attestation_function(VAL_INITIAL_ATTEST_GET_TOKEN_SIZE,
+                         challenge_size, &token_buffer_size);
+            size_latency_ns[iter] = token_elapsed(start);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(1));
+
+            if (token_buffer_size > PSA_INITIAL_ATTEST_MAX_TOKEN_SIZE)
+            {
+                val->print(PRINT_ERROR, "Insufficient token buffer size\n", 0);
+                return VAL_STATUS_INSUFFICIENT_SIZE;
+            }
+
+            start = token_timestamp();
+            status = val->attestation_function(VAL_INITIAL_ATTEST_GET_TOKEN, challenge,
+                         challenge_size, token_buffer, token_buffer_size, &token_size);
+            token_latency_ns[iter] = token_elapsed(start);
+            TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(2));
+
+            token_total_ns += token_latency_ns[iter];
+            if (token_size < token_size_min)
+                token_size_min = token_size;
+            if (token_size > token_size_max)
+                token_size_max = token_size;
+        }
+
+        /* The last token must still be valid, the others are alike */
+        status = val->attestation_function(VAL_INITIAL_ATTEST_VERIFY_TOKEN, challenge,
+                    challenge_size, token_buffer, token_size);
+        TEST_ASSERT_EQUAL(status, PSA_SUCCESS, TEST_CHECKPOINT_NUM(3));
+
+        token_sort(size_latency_ns, ARCH_TEST_ATTEST_TOKEN_ITERATIONS);
+        token_sort(token_latency_ns, ARCH_TEST_ATTEST_TOKEN_ITERATIONS);
+
+        val->print(PRINT_TEST, "[Series] %d,", (int32_t)challenge_size);
+        val->print(PRINT_TEST, "%d,", (int32_t)token_size_min);
+        val->print(PRINT_TEST, "%d,", (int32_t)token_size_max);
+        val->print(PRINT_TEST, "%d,", token_ns_to_print(size_latency_ns[p50]));
+        val->print(PRINT_TEST, "%d,", token_ns_to_print(size_latency_ns[p99]));
+        val->print(PRINT_TEST, "%d,",
+                   token_ns_to_print(token_total_ns / ARCH_TEST_ATTEST_TOKEN_ITERATIONS));
+        val->print(PRINT_TEST, "%d,", token_ns_to_print(token_latency_ns[p50]));
+        val->print(PRINT_TEST, "%d,", token_ns_to_print(token_latency_ns[p99]));
+        val->print(PRINT_TEST, "%d,",
+                   token_ns_to_print(token_latency_ns[ARCH_TEST_ATTEST_TOKEN_ITERATIONS - 1]));
+        val->print(PRINT_TEST, "%d\n", token_total_ns ?
+                   token_ns_to_print((1000000000ull * ARCH_TEST_ATTEST_TOKEN_ITERATIONS) /
+                                     token_total_ns) : 0);
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
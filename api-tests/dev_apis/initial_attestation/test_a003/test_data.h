@@ -0,0 +1,29 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_attestation.h"
+
+typedef struct {
+    char                    test_desc[100];
+    size_t                  challenge_size;
+} test_data;
+
+static const test_data check1[] = {
+{"Token size query and generation with Challenge 32\n", PSA_INITIAL_ATTEST_CHALLENGE_SIZE_32},
+{"Token size query and generation with Challenge 48\n", PSA_INITIAL_ATTEST_CHALLENGE_SIZE_48},
+{"Token size query and generation with Challenge 64\n", PSA_INITIAL_ATTEST_CHALLENGE_SIZE_64},
+};
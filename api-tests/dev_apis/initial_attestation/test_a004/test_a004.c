@@ -0,0 +1,91 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_a004.h"
+#include "test_data.h"
+
+/* Iterations per token, can be tuned by the platform in pal_config.h */
+#ifndef ARCH_TEST_ATTEST_PARSE_ITERATIONS
+#define ARCH_TEST_ATTEST_PARSE_ITERATIONS   1000
+#endif
+
+const client_test_t test_a004_attestation_list[] = {
+    NULL,
+    psa_initial_attestation_profile_benchmark,
+    NULL,
+};
+
+static int         g_test_count = 1;
+
+static uint64_t profile_timestamp(void)
+{
+    uint64_t timestamp = 0;
+
+    if (val->get_timestamp(&timestamp) != VAL_STATUS_SUCCESS)
+        timestamp = 0;
+    return timestamp;
+}
+
+static int32_t profile_ns_to_print(uint64_t ns)
+{
+    return (ns > INT_MAX) ? INT_MAX : (int32_t)ns;
+}
+
+int32_t psa_initial_attestation_profile_benchmark(caller_security_t caller __UNUSED)
+{
+    int         i, num_checks = sizeof(check1)/sizeof(check1[0]);
+    int32_t     status;
+    uint32_t    iter;
+    uint64_t    start, parse_ns;
+    uint8_t     challenge[PSA_INITIAL_ATTEST_CHALLENGE_SIZE_32];
+
+    if (val->get_timestamp(&start) != VAL_STATUS_SUCCESS)
+        val->print(PRINT_TEST, "[Info] No platform timestamp, latencies are reported as 0\n", 0);
+
+    val->print(PRINT_TEST, "[Info] Parse iterations %d\n", ARCH_TEST_ATTEST_PARSE_ITERATIONS);
+    val->print(PRINT_TEST, "[Series] check,token_size,status,parse_ns\n", 0);
+
+    memset(challenge, 0x2a, sizeof(challenge));
+
+    for (i = 0; i < num_checks; i++)
+    {
+        val->print(PRINT_TEST, "[Check %d] ", g_test_count);
+        val->print(PRINT_TEST, check1[i].test_desc, 0);
+
+        status = val->attestation_function(check1[i].parse_function, challenge,
+                    sizeof(challenge), (uint8_t *)check1[i].token, check1[i].token_size);
+        TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(1));
+
+        start = profile_timestamp();
+        for (iter = 0; iter < ARCH_TEST_ATTEST_PARSE_ITERATIONS; iter++)
+        {
+            status = val->attestation_function(check1[i].parse_function, challenge,
+                        sizeof(challenge), (uint8_t *)check1[i].token, check1[i].token_size);
+            TEST_ASSERT_EQUAL(status, check1[i].expected_status, TEST_CHECKPOINT_NUM(2));
+        }
+        parse_ns = (profile_timestamp() - start) / ARCH_TEST_ATTEST_PARSE_ITERATIONS;
+
+        val->print(PRINT_TEST, "[Series] %d,", g_test_count++);
+        val->print(PRINT_TEST, "%d,", (int32_t)check1[i].token_size);
+        val->print(PRINT_TEST, "%d,", status);
+        val->print(PRINT_TEST, "%d\n", profile_ns_to_print(parse_ns));
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
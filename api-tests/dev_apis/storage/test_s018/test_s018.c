@@ -0,0 +1,360 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_s018.h"
+#include "test_data.h"
+
+/* Churn profile, can be tuned by the platform in pal_storage_config.h */
+#ifndef ARCH_TEST_STORAGE_CHURN_SEED
+#define ARCH_TEST_STORAGE_CHURN_SEED           0x2545F491
+#endif
+#ifndef ARCH_TEST_STORAGE_CHURN_EPOCHS
+#define ARCH_TEST_STORAGE_CHURN_EPOCHS         16
+#endif
+#ifndef ARCH_TEST_STORAGE_CHURN_OPS_PER_EPOCH
+#define ARCH_TEST_STORAGE_CHURN_OPS_PER_EPOCH  128
+#endif
+/* Percentage of the initial free space the storage may lose once emptied again */
+#ifndef ARCH_TEST_STORAGE_CHURN_FREE_TOLERANCE_PCT
+#define ARCH_TEST_STORAGE_CHURN_FREE_TOLERANCE_PCT 0
+#endif
+
+#define CHURN_UID_COUNT       16
+#define PROBE_UID_MAX         1024
+#define TEST_BASE_UID_VALUE   (UID_BASE_VALUE + 5)
+#define PROBE_BASE_UID_VALUE  (TEST_BASE_UID_VALUE + CHURN_UID_COUNT)
+
+typedef struct {
+    uint32_t size;      /* Zero when the UID is not present in the storage */
+    uint8_t  tag;       /* Seed of the data pattern last written to the UID */
+} churn_slot_t;
+
+typedef struct {
+    uint32_t set_calls;
+    uint32_t set_failures;
+    uint64_t set_total_ns;
+    uint64_t set_max_ns;
+} churn_stats_t;
+
+const client_test_t s018_storage_test_list[] = {
+    NULL,
+    s018_storage_test,
+    NULL,
+};
+
+static churn_slot_t churn_slot[CHURN_UID_COUNT];
+static uint8_t      write_buff[ARCH_TEST_STORAGE_UID_MAX_SIZE];
+static uint8_t      read_buff[ARCH_TEST_STORAGE_UID_MAX_SIZE];
+static uint32_t     rand_state;
+
+/* xorshift32, keeps the operation sequence identical across platforms for a given seed */
+static uint32_t churn_rand(void)
+{
+    rand_state ^= rand_state << 13;
+    rand_state ^= rand_state >> 17;
+    rand_state ^= rand_state << 5;
+    return rand_state;
+}
+
+static uint32_t churn_range(uint32_t low, uint32_t high)
+{
+    if (high <= low)
+        return low;
+    return low + (churn_rand() % (high - low + 1));
+}
+
+/* Mixed object sizes: 50% small, 30% medium and 20% large objects */
+static uint32_t churn_size(void)
+{
+    uint32_t pick = churn_rand() % 10;
+    uint32_t max  = ARCH_TEST_STORAGE_UID_MAX_SIZE;
+
+    if (pick < 5)
+        return churn_range(1, max / 16);
+    if (pick < 8)
+        return churn_range((max / 16) + 1, max / 4);
+    return churn_range((max / 4) + 1, max);
+}
+
+static void churn_fill(uint8_t *buff, uint32_t size, uint8_t tag)
+{
+    uint32_t i;
+
+    for (i = 0; i < size; i++)
+        buff[i] = (uint8_t)(tag + (i * 7));
+}
+
+/* Latencies are reported as zero when the platform has no timestamp source */
+static uint64_t churn_timestamp(void)
+{
+    uint64_t timestamp = 0;
+
+    if (val->get_timestamp(&timestamp) != VAL_STATUS_SUCCESS)
+        timestamp = 0;
+    return timestamp;
+}
+
+static int32_t churn_ns_to_print(uint64_t ns)
+{
+    return (ns > INT_MAX) ? INT_MAX : (int32_t)ns;
+}
+
+/*
+ * Fills the free space with max size UIDs and removes them again. The space a
+ * max size UID can still be placed in is what fragmentation takes away, so the
+ * achievable free space is the size of the probe UIDs that could be set.
+ */
+static int32_t churn_probe_free(storage_function_code_t fCode, uint32_t *free_bytes)
+{
+    int32_t           status = PSA_SUCCESS;
+    psa_storage_uid_t uid;
+    uint32_t          count  = 0;
+
+    memset(write_buff, 0xA5, ARCH_TEST_STORAGE_UID_MAX_SIZE);
+    for (uid = PROBE_BASE_UID_VALUE; count < PROBE_UID_MAX; uid++)
+    {
+        status = STORAGE_FUNCTION(s018_data[VAL_TEST_IDX4].api[fCode], uid,
+                                  ARCH_TEST_STORAGE_UID_MAX_SIZE, write_buff,
+                                  PSA_STORAGE_FLAG_NONE);
+        if (status != PSA_SUCCESS)
+            break;
+        count++;
+    }
+    if (count < PROBE_UID_MAX)
+    {
+        TEST_ASSERT_EQUAL(status, s018_data[VAL_TEST_IDX4].status, TEST_CHECKPOINT_NUM(6));
+    }
+
+    for (uid = PROBE_BASE_UID_VALUE; uid < (PROBE_BASE_UID_VALUE + count); uid++)
+    {
+        status = STORAGE_FUNCTION(s018_data[VAL_TEST_IDX5].api[fCode], uid);
+        TEST_ASSERT_EQUAL(status, s018_data[VAL_TEST_IDX5].status, TEST_CHECKPOINT_NUM(7));
+    }
+
+    *free_bytes = count * ARCH_TEST_STORAGE_UID_MAX_SIZE;
+    return VAL_STATUS_SUCCESS;
+}
+
+static void churn_print_row(uint32_t epoch, uint32_t live_uids, uint32_t live_bytes,
+                            uint32_t free_bytes, uint32_t baseline, churn_stats_t *stats)
+{
+    uint64_t avg_ns = stats->set_calls ? (stats->set_total_ns / stats->set_calls) : 0;
+
+    val->print(PRINT_TEST, "[Series] %d,", (int32_t)epoch);
+    val->print(PRINT_TEST, "%d,", (int32_t)live_uids);
+    val->print(PRINT_TEST, "%d,", (int32_t)live_bytes);
+    val->print(PRINT_TEST, "%d,", (int32_t)free_bytes);
+    val->print(PRINT_TEST, "%d,", baseline ? (int32_t)((free_bytes * 100ULL) / baseline) : 0);
+    val->print(PRINT_TEST, "%d,", (int32_t)stats->set_calls);
+    val->print(PRINT_TEST, "%d,", churn_ns_to_print(avg_ns));
+    val->print(PRINT_TEST, "%d,", churn_ns_to_print(stats->set_max_ns));
+    val->print(PRINT_TEST, "%d\n", (int32_t)stats->set_failures);
+}
+
+static int32_t churn_verify_live_uids(storage_function_code_t fCode, uint32_t *live_uids,
+                                      uint32_t *live_bytes)
+{
+    int32_t  status;
+    uint32_t idx;
+    size_t   p_data_length = 0;
+
+    *live_uids  = 0;
+    *live_bytes = 0;
+    for (idx = 0; idx < CHURN_UID_COUNT; idx++)
+    {
+        if (!churn_slot[idx].size)
+            continue;
+
+        status = STORAGE_FUNCTION(s018_data[VAL_TEST_IDX3].api[fCode], TEST_BASE_UID_VALUE + idx,
+                                  0, churn_slot[idx].size, read_buff, &p_data_length);
+        TEST_ASSERT_EQUAL(status, s018_data[VAL_TEST_IDX3].status, TEST_CHECKPOINT_NUM(3));
+        /* Compared by hand, TEST_ASSERT_EQUAL would take a 0xFF length for a skip */
+        if (p_data_length != churn_slot[idx].size)
+        {
+            val->print(PRINT_ERROR, "\tFailed at Checkpoint: %d\n", TEST_CHECKPOINT_NUM(4));
+            val->print(PRINT_ERROR, "\tLength: %d", (int32_t)p_data_length);
+            val->print(PRINT_ERROR, " instead of %d\n", (int32_t)churn_slot[idx].size);
+            return VAL_STATUS_ERROR;
+        }
+        churn_fill(write_buff, churn_slot[idx].size, churn_slot[idx].tag);
+        TEST_ASSERT_MEMCMP(read_buff, write_buff, churn_slot[idx].size, TEST_CHECKPOINT_NUM(5));
+
+        *live_uids  += 1;
+        *live_bytes += churn_slot[idx].size;
+    }
+    return VAL_STATUS_SUCCESS;
+}
+
+static int32_t psa_sst_capacity_churn(storage_function_code_t fCode)
+{
+    int32_t           status;
+    psa_storage_uid_t uid;
+    churn_slot_t      *slot;
+    churn_stats_t     stats;
+    uint32_t          epoch, op, idx, size;
+    uint32_t          live_uids = 0, live_bytes = 0;
+    uint32_t          baseline = 0, free_bytes = 0, min_free;
+    uint32_t          failure_onset = 0;
+    uint64_t          start, elapsed;
+    uint8_t           tag;
+
+    /* Both storage APIs replay the same sequence so their series can be compared */
+    rand_state = ARCH_TEST_STORAGE_CHURN_SEED ? ARCH_TEST_STORAGE_CHURN_SEED : 1;
+    memset(churn_slot, 0, sizeof(churn_slot));
+    memset(&stats, 0, sizeof(stats));
+
+    /* Free space of the empty storage is the reference for the whole run */
+    status = churn_probe_free(fCode, &baseline);
+    if (status != VAL_STATUS_SUCCESS)
+        return status;
+    min_free = baseline;
+
+    val->print(PRINT_TEST, "[Check 1] Churn %d epochs of ", ARCH_TEST_STORAGE_CHURN_EPOCHS);
+    val->print(PRINT_TEST, "%d mixed size set/remove calls\n",
+                           ARCH_TEST_STORAGE_CHURN_OPS_PER_EPOCH);
+    val->print(PRINT_TEST, "[Info] Seed 0x%x\n", (int32_t)rand_state);
+    val->print(PRINT_TEST, "[Series] epoch,live_uids,live_bytes,free_bytes,free_pct,"
+                           "set_calls,set_avg_ns,set_max_ns,set_failures\n", 0);
+    churn_print_row(0, 0, 0, baseline, baseline, &stats);
+
+    for (epoch = 1; epoch <= ARCH_TEST_STORAGE_CHURN_EPOCHS; epoch++)
+    {
+        memset(&stats, 0, sizeof(stats));
+        for (op = 0; op < ARCH_TEST_STORAGE_CHURN_OPS_PER_EPOCH; op++)
+        {
+            idx  = churn_rand() % CHURN_UID_COUNT;
+            slot = &churn_slot[idx];
+            uid  = TEST_BASE_UID_VALUE + idx;
+
+            /* Live UIDs are removed half of the time and rewritten otherwise */
+            if (slot->size && (churn_rand() & 1))
+            {
+                status = STORAGE_FUNCTION(s018_data[VAL_TEST_IDX2].api[fCode], uid);
+                TEST_ASSERT_EQUAL(status, s018_data[VAL_TEST_IDX2].status,
+                                  TEST_CHECKPOINT_NUM(1));
+                slot->size = 0;
+                continue;
+            }
+
+            size = churn_size();
+            tag  = (uint8_t)churn_rand();
+            churn_fill(write_buff, size, tag);
+
+            start   = churn_timestamp();
+            status  = STORAGE_FUNCTION(s018_data[VAL_TEST_IDX1].api[fCode], uid, size,
+                                       write_buff, PSA_STORAGE_FLAG_NONE);
+            elapsed = churn_timestamp() - start;
+
+            stats.set_calls++;
+            stats.set_total_ns += elapsed;
+            if (elapsed > stats.set_max_ns)
+                stats.set_max_ns = elapsed;
+
+            /* A failed set must leave the previous data of the UID untouched */
+            if (status != PSA_SUCCESS)
+            {
+                TEST_ASSERT_EQUAL(status, s018_data[VAL_TEST_IDX1].status,
+                                  TEST_CHECKPOINT_NUM(2));
+                stats.set_failures++;
+                if (!failure_onset)
+                {
+                    failure_onset = ((epoch - 1) * ARCH_TEST_STORAGE_CHURN_OPS_PER_EPOCH)
+                                    + op + 1;
+                }
+                continue;
+            }
+
+            slot->size = size;
+            slot->tag  = tag;
+        }
+
+        status = churn_verify_live_uids(fCode, &live_uids, &live_bytes);
+        if (status != VAL_STATUS_SUCCESS)
+            return status;
+
+        status = churn_probe_free(fCode, &free_bytes);
+        if (status != VAL_STATUS_SUCCESS)
+            return status;
+
+        if (free_bytes < min_free)
+            min_free = free_bytes;
+        churn_print_row(epoch, live_uids, live_bytes, free_bytes, baseline, &stats);
+    }
+
+    if (failure_onset)
+        val->print(PRINT_TEST, "[Info] First set failure at call %d\n", (int32_t)failure_onset);
+    else
+        val->print(PRINT_TEST, "[Info] No set failure during the churn\n", 0);
+    val->print(PRINT_TEST, "[Info] Lowest achievable free space %d bytes", (int32_t)min_free);
+    val->print(PRINT_TEST, " of %d bytes\n", (int32_t)baseline);
+
+    /* Once everything is removed the initial free space must be available again */
+    val->print(PRINT_TEST, "[Check 2] Remove all UIDs and check no free space is lost\n", 0);
+    for (idx = 0; idx < CHURN_UID_COUNT; idx++)
+    {
+        if (!churn_slot[idx].size)
+            continue;
+
+        status = STORAGE_FUNCTION(s018_data[VAL_TEST_IDX2].api[fCode], TEST_BASE_UID_VALUE + idx);
+        TEST_ASSERT_EQUAL(status, s018_data[VAL_TEST_IDX2].status, TEST_CHECKPOINT_NUM(8));
+        churn_slot[idx].size = 0;
+    }
+
+    status = churn_probe_free(fCode, &free_bytes);
+    if (status != VAL_STATUS_SUCCESS)
+        return status;
+
+    if ((free_bytes * 100ULL) <
+        (baseline * (100ULL - ARCH_TEST_STORAGE_CHURN_FREE_TOLERANCE_PCT)))
+    {
+        val->print(PRINT_ERROR, "\tERROR : Free space after churn is %d bytes",
+                   (int32_t)free_bytes);
+        val->print(PRINT_ERROR, " but was %d bytes before\n", (int32_t)baseline);
+        return VAL_STATUS_ERROR;
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+int32_t s018_storage_test(caller_security_t caller __UNUSED)
+{
+    int32_t  status;
+    uint64_t timestamp;
+
+    if (val->get_timestamp(&timestamp) != VAL_STATUS_SUCCESS)
+        val->print(PRINT_TEST, "[Info] No platform timestamp, latencies are reported as 0\n", 0);
+
+#if defined(STORAGE) || defined(INTERNAL_TRUSTED_STORAGE)
+    val->print(PRINT_TEST, ITS_TEST_MESSAGE, 0);
+    status = psa_sst_capacity_churn(VAL_ITS_FUNCTION);
+    if (status != VAL_STATUS_SUCCESS) {
+        return status;
+    }
+#endif
+
+#if defined(STORAGE) || defined(PROTECTED_STORAGE)
+    val->print(PRINT_TEST, PS_TEST_MESSAGE, 0);
+    status = psa_sst_capacity_churn(VAL_PS_FUNCTION);
+    if (status != VAL_STATUS_SUCCESS) {
+        return status;
+    }
+#endif
+
+    return VAL_STATUS_SUCCESS;
+}
@@ -0,0 +1,55 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+#ifndef _S019_TEST_DATA_H_
+#define _S019_TEST_DATA_H_
+
+#include "test_s019.h"
+
+static const test_data_t s019_data[] = {
+{
+    VAL_TEST_IDX0, {VAL_API_UNUSED, VAL_API_UNUSED}, 0
+},
+{
+    /* Set of a private or shared UID */
+    VAL_TEST_IDX1, {VAL_ITS_SET, VAL_PS_SET}, PSA_SUCCESS
+},
+{
+    /* Get of a UID present in the shadow model */
+    VAL_TEST_IDX2, {VAL_ITS_GET, VAL_PS_GET}, PSA_SUCCESS
+},
+{
+    /* Get info of a UID present in the shadow model */
+    VAL_TEST_IDX3, {VAL_ITS_GET_INFO, VAL_PS_GET_INFO}, PSA_SUCCESS
+},
+{
+    /* Remove of a UID present in the shadow model */
+    VAL_TEST_IDX4, {VAL_ITS_REMOVE, VAL_PS_REMOVE}, PSA_SUCCESS
+},
+{
+    /* Get of a removed UID */
+    VAL_TEST_IDX5, {VAL_ITS_GET, VAL_PS_GET}, PSA_ERROR_DOES_NOT_EXIST
+},
+{
+    /* Get info of a removed UID */
+    VAL_TEST_IDX6, {VAL_ITS_GET_INFO, VAL_PS_GET_INFO}, PSA_ERROR_DOES_NOT_EXIST
+},
+{
+    /* Remove of a removed UID */
+    VAL_TEST_IDX7, {VAL_ITS_REMOVE, VAL_PS_REMOVE}, PSA_ERROR_DOES_NOT_EXIST
+},
+};
+#endif /* _S019_TEST_DATA_H_ */
@@ -0,0 +1,525 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_s019.h"
+#include "test_data.h"
+
+/* Stress profile, can be tuned by the platform in pal_storage_config.h */
+#ifndef ARCH_TEST_STORAGE_STRESS_MAX_THREADS
+#define ARCH_TEST_STORAGE_STRESS_MAX_THREADS  8
+#endif
+#ifndef ARCH_TEST_STORAGE_STRESS_OPS
+#define ARCH_TEST_STORAGE_STRESS_OPS          512
+#endif
+
+#define SHARED_UID_COUNT         4
+#define PRIVATE_UID_COUNT        4
+#define PRIVATE_MAX_SIZE         64
+#define SHARED_RECORD_SIZE       64
+#define TEST_BASE_UID_VALUE      (UID_BASE_VALUE + 5)
+#define PRIVATE_BASE_UID_VALUE   (TEST_BASE_UID_VALUE + SHARED_UID_COUNT)
+#define PRIVATE_UID(t, i)        (PRIVATE_BASE_UID_VALUE + ((t) * PRIVATE_UID_COUNT) + (i))
+
+typedef enum {
+    STRESS_DISJOINT    = 0,     /* Every thread works on its own private UIDs */
+    STRESS_OVERLAPPING = 1,     /* All threads set and get the same shared UIDs */
+} stress_pattern_t;
+
+/*
+ * Content of a shared UID. The fill bytes and the check word are derived from
+ * the other fields, so a record mixing two writes is detected as torn.
+ */
+typedef struct {
+    uint32_t uid_idx;
+    uint32_t writer;            /* Thread index + 1, zero for the initial population */
+    uint32_t seq;               /* Per writer sequence number, starts from one */
+    uint32_t check;
+    uint8_t  fill[SHARED_RECORD_SIZE - 16];
+} shared_record_t;
+
+typedef struct {
+    uint32_t size;              /* Zero when the UID is not present in the storage */
+    uint8_t  tag;
+} private_slot_t;
+
+typedef struct {
+    uint32_t       rand_state;
+    uint32_t       checkpoint;  /* Zero while the thread has not seen a failure */
+    int32_t        actual;
+    int32_t        expected;
+    private_slot_t slot[PRIVATE_UID_COUNT];
+    uint8_t        write_buff[PRIVATE_MAX_SIZE];
+    uint8_t        read_buff[PRIVATE_MAX_SIZE];
+} stress_thread_t;
+
+const client_test_t s019_storage_test_list[] = {
+    NULL,
+    s019_storage_test,
+    NULL,
+};
+
+static storage_function_code_t g_fCode;
+static stress_pattern_t        g_pattern;
+static stress_thread_t         g_thread[ARCH_TEST_STORAGE_STRESS_MAX_THREADS];
+
+/*
+ * Linearizability bookkeeping of the shared UIDs, driven by a logical clock:
+ * a set is stamped with a tick before it is issued and after it returns. A get
+ * may not return a write that ended before another write to the same UID was
+ * issued, if that other write had already returned when the get was issued.
+ */
+static uint32_t g_clock;
+static uint32_t g_issued_seq[ARCH_TEST_STORAGE_STRESS_MAX_THREADS];
+static uint32_t g_write_end[ARCH_TEST_STORAGE_STRESS_MAX_THREADS][ARCH_TEST_STORAGE_STRESS_OPS + 1];
+static uint32_t g_completed_start[SHARED_UID_COUNT];
+
+/* xorshift32, keeps the operation sequence of a thread identical across runs */
+static uint32_t stress_rand(stress_thread_t *ctx)
+{
+    ctx->rand_state ^= ctx->rand_state << 13;
+    ctx->rand_state ^= ctx->rand_state >> 17;
+    ctx->rand_state ^= ctx->rand_state << 5;
+    return ctx->rand_state;
+}
+
+static uint32_t stress_tick(void)
+{
+    return __atomic_add_fetch(&g_clock, 1, __ATOMIC_SEQ_CST);
+}
+
+static void stress_atomic_max(uint32_t *target, uint32_t value)
+{
+    uint32_t current = __atomic_load_n(target, __ATOMIC_SEQ_CST);
+
+    while ((current < value) &&
+           !__atomic_compare_exchange_n(target, &current, value, 0,
+                                        __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST))
+        ;
+}
+
+/* Records the first failure of a thread, reported by the main thread after the join */
+static void stress_fail(stress_thread_t *ctx, uint32_t checkpoint, int32_t actual,
+                        int32_t expected)
+{
+    if (ctx->checkpoint)
+        return;
+    ctx->checkpoint = checkpoint;
+    ctx->actual     = actual;
+    ctx->expected   = expected;
+}
+
+static void stress_fill(uint8_t *buff, uint32_t size, uint8_t tag)
+{
+    uint32_t i;
+
+    for (i = 0; i < size; i++)
+        buff[i] = (uint8_t)(tag + (i * 7));
+}
+
+static uint32_t shared_check(uint32_t uid_idx, uint32_t writer, uint32_t seq)
+{
+    return ((uid_idx + 1) * 0x9E3779B1u) ^ (writer * 0x85EBCA77u) ^ (seq * 0xC2B2AE3Du);
+}
+
+static void shared_record_build(shared_record_t *record, uint32_t uid_idx, uint32_t writer,
+                                uint32_t seq)
+{
+    record->uid_idx = uid_idx;
+    record->writer  = writer;
+    record->seq     = seq;
+    record->check   = shared_check(uid_idx, writer, seq);
+    stress_fill(record->fill, sizeof(record->fill), (uint8_t)record->check);
+}
+
+static void stress_disjoint_op(stress_thread_t *ctx, uint32_t thread_idx)
+{
+    int32_t                   status;
+    uint32_t                  idx  = stress_rand(ctx) % PRIVATE_UID_COUNT;
+    uint32_t                  pick = stress_rand(ctx) % 10;
+    private_slot_t            *slot = &ctx->slot[idx];
+    psa_storage_uid_t         uid  = PRIVATE_UID(thread_idx, idx);
+    struct psa_storage_info_t info = {0};
+    size_t                    p_data_length = 0;
+    uint32_t                  size;
+    uint8_t                   tag;
+
+    if (pick < 4)
+    {
+        size = 1 + (stress_rand(ctx) % PRIVATE_MAX_SIZE);
+        tag  = (uint8_t)stress_rand(ctx);
+        stress_fill(ctx->write_buff, size, tag);
+        status = STORAGE_FUNCTION(s019_data[VAL_TEST_IDX1].api[g_fCode], uid, size,
+                                  ctx->write_buff, PSA_STORAGE_FLAG_NONE);
+        if (status != s019_data[VAL_TEST_IDX1].status)
+        {
+            stress_fail(ctx, 1, status, s019_data[VAL_TEST_IDX1].status);
+            return;
+        }
+        slot->size = size;
+        slot->tag  = tag;
+    }
+    else if (pick < 7)
+    {
+        if (!slot->size)
+        {
+            status = STORAGE_FUNCTION(s019_data[VAL_TEST_IDX5].api[g_fCode], uid, 0,
+                                      PRIVATE_MAX_SIZE, ctx->read_buff, &p_data_length);
+            if (status != s019_data[VAL_TEST_IDX5].status)
+                stress_fail(ctx, 2, status, s019_data[VAL_TEST_IDX5].status);
+            return;
+        }
+
+        status = STORAGE_FUNCTION(s019_data[VAL_TEST_IDX2].api[g_fCode], uid, 0,
+                                  slot->size, ctx->read_buff, &p_data_length);
+        if (status != s019_data[VAL_TEST_IDX2].status)
+        {
+            stress_fail(ctx, 3, status, s019_data[VAL_TEST_IDX2].status);
+            return;
+        }
+        if (p_data_length != slot->size)
+        {
+            stress_fail(ctx, 4, (int32_t)p_data_length, (int32_t)slot->size);
+            return;
+        }
+        stress_fill(ctx->write_buff, slot->size, slot->tag);
+        if (memcmp(ctx->read_buff, ctx->write_buff, slot->size))
+            stress_fail(ctx, 5, 1, 0);
+    }
+    else if (pick < 9)
+    {
+        if (!slot->size)
+        {
+            status = STORAGE_FUNCTION(s019_data[VAL_TEST_IDX6].api[g_fCode], uid, &info);
+            if (status != s019_data[VAL_TEST_IDX6].status)
+                stress_fail(ctx, 6, status, s019_data[VAL_TEST_IDX6].status);
+            return;
+        }
+
+        status = STORAGE_FUNCTION(s019_data[VAL_TEST_IDX3].api[g_fCode], uid, &info);
+        if (status != s019_data[VAL_TEST_IDX3].status)
+        {
+            stress_fail(ctx, 7, status, s019_data[VAL_TEST_IDX3].status);
+            return;
+        }
+        if (info.size != slot->size)
+        {
+            stress_fail(ctx, 8, (int32_t)info.size, (int32_t)slot->size);
+            return;
+        }
+        if (info.flags != PSA_STORAGE_FLAG_NONE)
+            stress_fail(ctx, 9, (int32_t)info.flags, PSA_STORAGE_FLAG_NONE);
+    }
+    else
+    {
+        if (!slot->size)
+        {
+            status = STORAGE_FUNCTION(s019_data[VAL_TEST_IDX7].api[g_fCode], uid);
+            if (status != s019_data[VAL_TEST_IDX7].status)
+                stress_fail(ctx, 10, status, s019_data[VAL_TEST_IDX7].status);
+            return;
+        }
+
+        status = STORAGE_FUNCTION(s019_data[VAL_TEST_IDX4].api[g_fCode], uid);
+        if (status != s019_data[VAL_TEST_IDX4].status)
+        {
+            stress_fail(ctx, 11, status, s019_data[VAL_TEST_IDX4].status);
+            return;
+        }
+        slot->size = 0;
+    }
+}
+
+static void stress_overlapping_op(stress_thread_t *ctx, uint32_t thread_idx, uint32_t *seq)
+{
+    int32_t                   status;
+    uint32_t                  idx  = stress_rand(ctx) % SHARED_UID_COUNT;
+    uint32_t                  pick = stress_rand(ctx) % 10;
+    psa_storage_uid_t         uid  = TEST_BASE_UID_VALUE + idx;
+    struct psa_storage_info_t info = {0};
+    shared_record_t           record, expected;
+    size_t                    p_data_length = 0;
+    uint32_t                  start, end, lower;
+
+    if (pick < 5)
+    {
+        *seq += 1;
+        shared_record_build(&record, idx, thread_idx + 1, *seq);
+        __atomic_store_n(&g_issued_seq[thread_idx], *seq, __ATOMIC_SEQ_CST);
+
+        start  = stress_tick();
+        status = STORAGE_FUNCTION(s019_data[VAL_TEST_IDX1].api[g_fCode], uid,
+                                  SHARED_RECORD_SIZE, &record, PSA_STORAGE_FLAG_NONE);
+        end    = stress_tick();
+        if (status != s019_data[VAL_TEST_IDX1].status)
+        {
+            stress_fail(ctx, 12, status, s019_data[VAL_TEST_IDX1].status);
+            return;
+        }
+
+        __atomic_store_n(&g_write_end[thread_idx][*seq], end, __ATOMIC_SEQ_CST);
+        stress_atomic_max(&g_completed_start[idx], start);
+    }
+    else if (pick < 9)
+    {
+        lower  = __atomic_load_n(&g_completed_start[idx], __ATOMIC_SEQ_CST);
+        status = STORAGE_FUNCTION(s019_data[VAL_TEST_IDX2].api[g_fCode], uid, 0,
+                                  SHARED_RECORD_SIZE, &record, &p_data_length);
+        if (status != s019_data[VAL_TEST_IDX2].status)
+        {
+            stress_fail(ctx, 13, status, s019_data[VAL_TEST_IDX2].status);
+            return;
+        }
+        if (p_data_length != SHARED_RECORD_SIZE)
+        {
+            stress_fail(ctx, 14, (int32_t)p_data_length, SHARED_RECORD_SIZE);
+            return;
+        }
+
+        /* The record must be one whole write to this UID */
+        if ((record.writer > ARCH_TEST_STORAGE_STRESS_MAX_THREADS) ||
+            (record.seq > ARCH_TEST_STORAGE_STRESS_OPS) ||
+            ((record.writer == 0) && (record.seq != 0)))
+        {
+            stress_fail(ctx, 15, (int32_t)record.writer, (int32_t)record.seq);
+            return;
+        }
+        shared_record_build(&expected, idx, record.writer, record.seq);
+        if (memcmp(&record, &expected, sizeof(record)))
+        {
+            stress_fail(ctx, 16, (int32_t)record.check, (int32_t)expected.check);
+            return;
+        }
+
+        /* ... that was issued before the get returned ... */
+        if (record.writer &&
+            ((record.seq == 0) ||
+             (record.seq > __atomic_load_n(&g_issued_seq[record.writer - 1], __ATOMIC_SEQ_CST))))
+        {
+            stress_fail(ctx, 17, (int32_t)record.seq, 0);
+            return;
+        }
+
+        /* ... and is not older than a write that had completed when the get was issued */
+        end = record.writer ? __atomic_load_n(&g_write_end[record.writer - 1][record.seq],
+                                              __ATOMIC_SEQ_CST) : 0;
+        if ((record.writer == 0 || end != 0) && (end < lower))
+            stress_fail(ctx, 18, (int32_t)end, (int32_t)lower);
+    }
+    else
+    {
+        status = STORAGE_FUNCTION(s019_data[VAL_TEST_IDX3].api[g_fCode], uid, &info);
+        if (status != s019_data[VAL_TEST_IDX3].status)
+        {
+            stress_fail(ctx, 19, status, s019_data[VAL_TEST_IDX3].status);
+            return;
+        }
+        if (info.size != SHARED_RECORD_SIZE)
+            stress_fail(ctx, 20, (int32_t)info.size, SHARED_RECORD_SIZE);
+    }
+}
+
+static void stress_thread(uint32_t thread_idx, void *arg)
+{
+    stress_thread_t *ctx = &g_thread[thread_idx];
+    uint32_t        op, seq = 0;
+
+    (void)arg;
+    for (op = 0; (op < ARCH_TEST_STORAGE_STRESS_OPS) && !ctx->checkpoint; op++)
+    {
+        if (g_pattern == STRESS_DISJOINT)
+            stress_disjoint_op(ctx, thread_idx);
+        else
+            stress_overlapping_op(ctx, thread_idx, &seq);
+    }
+}
+
+static void stress_reset(uint32_t num_threads)
+{
+    uint32_t t;
+
+    memset(g_thread, 0, sizeof(g_thread));
+    memset(g_issued_seq, 0, sizeof(g_issued_seq));
+    memset(g_write_end, 0, sizeof(g_write_end));
+    memset(g_completed_start, 0, sizeof(g_completed_start));
+    g_clock = 0;
+
+    for (t = 0; t < num_threads; t++)
+        g_thread[t].rand_state = 0x2545F491u ^ ((t + 1) * 0x9E3779B9u);
+}
+
+/* Removes the UIDs left by one run, from the shadow model of every thread */
+static int32_t stress_cleanup(uint32_t num_threads)
+{
+    int32_t  status;
+    uint32_t t, i;
+
+    for (t = 0; t < num_threads; t++)
+    {
+        for (i = 0; i < PRIVATE_UID_COUNT; i++)
+        {
+            if (!g_thread[t].slot[i].size)
+                continue;
+            status = STORAGE_FUNCTION(s019_data[VAL_TEST_IDX4].api[g_fCode], PRIVATE_UID(t, i));
+            TEST_ASSERT_EQUAL(status, s019_data[VAL_TEST_IDX4].status, TEST_CHECKPOINT_NUM(23));
+        }
+    }
+
+    if (g_pattern == STRESS_OVERLAPPING)
+    {
+        for (i = 0; i < SHARED_UID_COUNT; i++)
+        {
+            status = STORAGE_FUNCTION(s019_data[VAL_TEST_IDX4].api[g_fCode],
+                                      TEST_BASE_UID_VALUE + i);
+            TEST_ASSERT_EQUAL(status, s019_data[VAL_TEST_IDX4].status, TEST_CHECKPOINT_NUM(24));
+        }
+    }
+    return VAL_STATUS_SUCCESS;
+}
+
+static void stress_probe_thread(uint32_t thread_idx, void *arg)
+{
+    (void)thread_idx;
+    (void)arg;
+}
+
+static uint64_t stress_timestamp(void)
+{
+    uint64_t timestamp = 0;
+
+    if (val->get_timestamp(&timestamp) != VAL_STATUS_SUCCESS)
+        timestamp = 0;
+    return timestamp;
+}
+
+static int32_t stress_run(uint32_t num_threads, uint64_t *elapsed)
+{
+    int32_t         status;
+    uint32_t        t, i;
+    uint64_t        start;
+    shared_record_t record;
+
+    stress_reset(num_threads);
+
+    if (g_pattern == STRESS_OVERLAPPING)
+    {
+        for (i = 0; i < SHARED_UID_COUNT; i++)
+        {
+            shared_record_build(&record, i, 0, 0);
+            status = STORAGE_FUNCTION(s019_data[VAL_TEST_IDX1].api[g_fCode],
+                                      TEST_BASE_UID_VALUE + i, SHARED_RECORD_SIZE, &record,
+                                      PSA_STORAGE_FLAG_NONE);
+            TEST_ASSERT_EQUAL(status, s019_data[VAL_TEST_IDX1].status, TEST_CHECKPOINT_NUM(21));
+        }
+    }
+
+    start  = stress_timestamp();
+    status = val->run_threads(num_threads, stress_thread, NULL);
+    *elapsed = stress_timestamp() - start;
+    TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(22));
+
+    for (t = 0; t < num_threads; t++)
+    {
+        if (!g_thread[t].checkpoint)
+            continue;
+        val->print(PRINT_ERROR, "\tThread %d", (int32_t)t);
+        val->print(PRINT_ERROR, " failed at Checkpoint: %d\n", (int32_t)g_thread[t].checkpoint);
+        val->print(PRINT_ERROR, "\tActual: %d\n", g_thread[t].actual);
+        val->print(PRINT_ERROR, "\tExpected: %d\n", g_thread[t].expected);
+        return VAL_STATUS_ERROR;
+    }
+
+    return stress_cleanup(num_threads);
+}
+
+static int32_t psa_sst_concurrent_stress(storage_function_code_t fCode)
+{
+    int32_t  status;
+    uint32_t num_threads, ops;
+    uint64_t elapsed, ops_per_sec, base_ops_per_sec;
+
+    g_fCode = fCode;
+    for (g_pattern = STRESS_DISJOINT; g_pattern <= STRESS_OVERLAPPING; g_pattern++)
+    {
+        if (g_pattern == STRESS_DISJOINT)
+            val->print(PRINT_TEST, "[Check 1] Private UIDs per thread against a shadow model\n", 0);
+        else
+            val->print(PRINT_TEST, "[Check 2] Shared UIDs, no torn or stale reads\n", 0);
+        val->print(PRINT_TEST, "[Series] pattern,threads,ops,elapsed_ns,ops_per_sec,"
+                               "scaling_pct\n", 0);
+
+        base_ops_per_sec = 0;
+        for (num_threads = 1; num_threads <= ARCH_TEST_STORAGE_STRESS_MAX_THREADS;
+             num_threads *= 2)
+        {
+            status = stress_run(num_threads, &elapsed);
+            if (status != VAL_STATUS_SUCCESS)
+                return status;
+
+            ops         = num_threads * ARCH_TEST_STORAGE_STRESS_OPS;
+            ops_per_sec = elapsed ? ((ops * 1000000000ULL) / elapsed) : 0;
+            if (num_threads == 1)
+                base_ops_per_sec = ops_per_sec;
+
+            val->print(PRINT_TEST, "[Series] %d,", (int32_t)g_pattern);
+            val->print(PRINT_TEST, "%d,", (int32_t)num_threads);
+            val->print(PRINT_TEST, "%d,", (int32_t)ops);
+            val->print(PRINT_TEST, "%d,", (elapsed > INT_MAX) ? INT_MAX : (int32_t)elapsed);
+            val->print(PRINT_TEST, "%d,", (ops_per_sec > INT_MAX) ? INT_MAX : (int32_t)ops_per_sec);
+            val->print(PRINT_TEST, "%d\n", base_ops_per_sec ?
+                                   (int32_t)((ops_per_sec * 100) / base_ops_per_sec) : 0);
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+int32_t s019_storage_test(caller_security_t caller __UNUSED)
+{
+    int32_t  status;
+    uint64_t timestamp;
+
+    /* A single threaded run tells nothing about concurrency, skip without threads */
+    status = val->run_threads(1, stress_probe_thread, NULL);
+    if (status == VAL_STATUS_UNSUPPORTED)
+    {
+        val->print(PRINT_TEST, "[Info] Platform cannot run threads, test skipped\n", 0);
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+    }
+
+    if (val->get_timestamp(&timestamp) != VAL_STATUS_SUCCESS)
+        val->print(PRINT_TEST, "[Info] No platform timestamp, throughput is reported as 0\n", 0);
+
+#if defined(STORAGE) || defined(INTERNAL_TRUSTED_STORAGE)
+    val->print(PRINT_TEST, ITS_TEST_MESSAGE, 0);
+    status = psa_sst_concurrent_stress(VAL_ITS_FUNCTION);
+    if (status != VAL_STATUS_SUCCESS) {
+        return status;
+    }
+#endif
+
+#if defined(STORAGE) || defined(PROTECTED_STORAGE)
+    val->print(PRINT_TEST, PS_TEST_MESSAGE, 0);
+    status = psa_sst_concurrent_stress(VAL_PS_FUNCTION);
+    if (status != VAL_STATUS_SUCCESS) {
+        return status;
+    }
+#endif
+
+    return VAL_STATUS_SUCCESS;
+}
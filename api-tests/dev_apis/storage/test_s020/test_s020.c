@@ -0,0 +1,334 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_s020.h"
+#include "test_data.h"
+
+/* Crash profile, can be tuned by the platform in pal_storage_config.h */
+#ifndef ARCH_TEST_STORAGE_CRASH_SEED
+#define ARCH_TEST_STORAGE_CRASH_SEED        0x6C078965
+#endif
+#ifndef ARCH_TEST_STORAGE_CRASH_ITERATIONS
+#define ARCH_TEST_STORAGE_CRASH_ITERATIONS  32
+#endif
+
+#define CRASH_UID_COUNT       4
+#define CRASH_HEADER_SIZE     16
+#define CRASH_MIN_SIZE        (CRASH_HEADER_SIZE + 1)
+#define TEST_BASE_UID_VALUE   (UID_BASE_VALUE + 5)
+
+/* Kill delay used when the platform has no timestamp to calibrate against */
+#define CRASH_DEFAULT_WINDOW_US  1000
+
+/*
+ * Every record starts with a header naming its generation, the size and the
+ * content of the rest are derived from it. A record that is neither the old
+ * nor the new generation of the UID, or is cut short, is a torn write.
+ */
+typedef struct {
+    uint32_t uid_idx;
+    uint32_t gen;
+    uint32_t size;
+    uint32_t check;
+} crash_header_t;
+
+typedef struct {
+    storage_function_code_t fCode;
+    uint32_t                gen;
+} crash_job_t;
+
+const client_test_t s020_storage_test_list[] = {
+    NULL,
+    s020_storage_test,
+    NULL,
+};
+
+static uint8_t  write_buff[ARCH_TEST_STORAGE_UID_MAX_SIZE];
+static uint8_t  read_buff[ARCH_TEST_STORAGE_UID_MAX_SIZE];
+static uint8_t  expect_buff[ARCH_TEST_STORAGE_UID_MAX_SIZE];
+static uint32_t live_gen[CRASH_UID_COUNT];
+static uint32_t rand_state;
+
+/* xorshift32, keeps the kill points identical across runs for a given seed */
+static uint32_t crash_rand(void)
+{
+    rand_state ^= rand_state << 13;
+    rand_state ^= rand_state >> 17;
+    rand_state ^= rand_state << 5;
+    return rand_state;
+}
+
+static uint32_t crash_check(uint32_t uid_idx, uint32_t gen)
+{
+    return ((uid_idx + 1) * 0x9E3779B1u) ^ (gen * 0x85EBCA77u);
+}
+
+/* Sizes change with every generation so that a torn length is detected too */
+static uint32_t crash_size(uint32_t uid_idx, uint32_t gen)
+{
+    return CRASH_MIN_SIZE +
+           (crash_check(uid_idx, gen) % (ARCH_TEST_STORAGE_UID_MAX_SIZE - CRASH_MIN_SIZE + 1));
+}
+
+static uint32_t crash_build(uint8_t *buff, uint32_t uid_idx, uint32_t gen)
+{
+    crash_header_t header;
+    uint32_t       i;
+
+    header.uid_idx = uid_idx;
+    header.gen     = gen;
+    header.size    = crash_size(uid_idx, gen);
+    header.check   = crash_check(uid_idx, gen);
+    memcpy(buff, &header, sizeof(header));
+    for (i = sizeof(header); i < header.size; i++)
+        buff[i] = (uint8_t)(header.check + (i * 7));
+    return header.size;
+}
+
+static uint64_t crash_timestamp(void)
+{
+    uint64_t timestamp = 0;
+
+    if (val->get_timestamp(&timestamp) != VAL_STATUS_SUCCESS)
+        timestamp = 0;
+    return timestamp;
+}
+
+/* Runs in the process that gets killed, so it only writes and never prints */
+static void crash_writer(void *arg)
+{
+    crash_job_t *job = (crash_job_t *)arg;
+    uint32_t    idx, size;
+
+    for (idx = 0; idx < CRASH_UID_COUNT; idx++)
+    {
+        size = crash_build(write_buff, idx, job->gen);
+        STORAGE_FUNCTION(s020_data[VAL_TEST_IDX1].api[job->fCode], TEST_BASE_UID_VALUE + idx,
+                         size, write_buff, PSA_STORAGE_FLAG_NONE);
+    }
+}
+
+/*
+ * Checks every UID holds either its last known generation or new_gen and
+ * updates live_gen. The time of this first pass over the storage after the
+ * crash is the recovery scan time.
+ */
+static int32_t crash_recover(storage_function_code_t fCode, uint32_t new_gen,
+                             uint32_t *new_count, uint64_t *recovery_ns)
+{
+    int32_t                   status;
+    uint32_t                  idx, size;
+    struct psa_storage_info_t info = {0};
+    crash_header_t            header;
+    size_t                    p_data_length = 0;
+    uint64_t                  start;
+
+    *new_count = 0;
+    start = crash_timestamp();
+    for (idx = 0; idx < CRASH_UID_COUNT; idx++)
+    {
+        status = STORAGE_FUNCTION(s020_data[VAL_TEST_IDX2].api[fCode], TEST_BASE_UID_VALUE + idx,
+                                  &info);
+        TEST_ASSERT_EQUAL(status, s020_data[VAL_TEST_IDX2].status, TEST_CHECKPOINT_NUM(2));
+
+        status = STORAGE_FUNCTION(s020_data[VAL_TEST_IDX3].api[fCode], TEST_BASE_UID_VALUE + idx,
+                                  0, ARCH_TEST_STORAGE_UID_MAX_SIZE, read_buff, &p_data_length);
+        TEST_ASSERT_EQUAL(status, s020_data[VAL_TEST_IDX3].status, TEST_CHECKPOINT_NUM(3));
+        /* Lengths are compared by hand, TEST_ASSERT_* would take 0xFF bytes for a skip */
+        if ((p_data_length != info.size) || (p_data_length < CRASH_MIN_SIZE))
+        {
+            val->print(PRINT_ERROR, "\tFailed at Checkpoint: %d\n", TEST_CHECKPOINT_NUM(4));
+            val->print(PRINT_ERROR, "\tLength: %d\n", (int32_t)p_data_length);
+            return VAL_STATUS_ERROR;
+        }
+
+        /* Compared by hand too, a torn generation reading 0xFF must fail, not skip */
+        memcpy(&header, read_buff, sizeof(header));
+        if ((header.gen != live_gen[idx]) && (header.gen != new_gen))
+        {
+            val->print(PRINT_ERROR, "\tFailed at Checkpoint: %d\n", TEST_CHECKPOINT_NUM(5));
+            val->print(PRINT_ERROR, "\tGeneration: %d", (int32_t)header.gen);
+            val->print(PRINT_ERROR, " instead of %d", (int32_t)live_gen[idx]);
+            val->print(PRINT_ERROR, " or %d\n", (int32_t)new_gen);
+            return VAL_STATUS_ERROR;
+        }
+
+        size = crash_build(expect_buff, idx, header.gen);
+        if (p_data_length != size)
+        {
+            val->print(PRINT_ERROR, "\tFailed at Checkpoint: %d\n", TEST_CHECKPOINT_NUM(6));
+            val->print(PRINT_ERROR, "\tLength: %d", (int32_t)p_data_length);
+            val->print(PRINT_ERROR, " instead of %d\n", (int32_t)size);
+            return VAL_STATUS_ERROR;
+        }
+        TEST_ASSERT_MEMCMP(read_buff, expect_buff, size, TEST_CHECKPOINT_NUM(7));
+
+        if (header.gen == new_gen)
+            *new_count += 1;
+        live_gen[idx] = header.gen;
+    }
+    *recovery_ns = crash_timestamp() - start;
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Removes the CRASH_UID_COUNT UIDs of the test
+    @param    - fCode : ITS or PS
+    @return   - val_status_t
+**/
+static int32_t crash_remove(storage_function_code_t fCode)
+{
+    int32_t  status;
+    uint32_t idx;
+
+    for (idx = 0; idx < CRASH_UID_COUNT; idx++)
+    {
+        status = STORAGE_FUNCTION(s020_data[VAL_TEST_IDX4].api[fCode], TEST_BASE_UID_VALUE + idx);
+        TEST_ASSERT_EQUAL(status, s020_data[VAL_TEST_IDX4].status, TEST_CHECKPOINT_NUM(12));
+    }
+    return VAL_STATUS_SUCCESS;
+}
+
+static int32_t psa_sst_crash_consistency(storage_function_code_t fCode)
+{
+    int32_t     status;
+    crash_job_t job;
+    uint32_t    idx, size, iter, new_count, completed;
+    uint32_t    window_us, delay_us, killed = 0, partial = 0;
+    uint64_t    start, elapsed, recovery_ns;
+    uint64_t    recovery_total = 0, recovery_max = 0;
+
+    rand_state = ARCH_TEST_STORAGE_CRASH_SEED ? ARCH_TEST_STORAGE_CRASH_SEED : 1;
+    job.fCode  = fCode;
+
+    val->print(PRINT_TEST, "[Check 1] Set the initial generation of %d UIDs\n", CRASH_UID_COUNT);
+    for (idx = 0; idx < CRASH_UID_COUNT; idx++)
+    {
+        size   = crash_build(write_buff, idx, 1);
+        status = STORAGE_FUNCTION(s020_data[VAL_TEST_IDX1].api[fCode], TEST_BASE_UID_VALUE + idx,
+                                  size, write_buff, PSA_STORAGE_FLAG_NONE);
+        TEST_ASSERT_EQUAL(status, s020_data[VAL_TEST_IDX1].status, TEST_CHECKPOINT_NUM(1));
+        live_gen[idx] = 1;
+    }
+
+    /* An uninterrupted writer calibrates the kill window and shows the data is shared */
+    job.gen = 2;
+    start   = crash_timestamp();
+    status  = val->run_killable(crash_writer, &job, 0, &completed);
+    elapsed = crash_timestamp() - start;
+    TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(8));
+    TEST_ASSERT_EQUAL(completed, 1, TEST_CHECKPOINT_NUM(9));
+
+    status = crash_recover(fCode, job.gen, &new_count, &recovery_ns);
+    if (status != VAL_STATUS_SUCCESS)
+        return status;
+    if (new_count != CRASH_UID_COUNT)
+    {
+        val->print(PRINT_TEST, "[Info] Storage backend does not persist outside of the test"
+                               " process, test skipped\n", 0);
+        status = crash_remove(fCode);
+        if (status != VAL_STATUS_SUCCESS)
+            return status;
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+    }
+
+    /* Kill points span the writer run and a bit after it, to also hit the last set */
+    window_us = (uint32_t)(elapsed / 1000);
+    window_us = window_us ? (window_us + (window_us / 2)) : CRASH_DEFAULT_WINDOW_US;
+
+    val->print(PRINT_TEST, "[Check 2] Kill the writer at %d random points",
+                           ARCH_TEST_STORAGE_CRASH_ITERATIONS);
+    val->print(PRINT_TEST, " within %d us\n", (int32_t)window_us);
+    val->print(PRINT_TEST, "[Series] iteration,kill_delay_us,killed,new_uids,old_uids,"
+                           "recovery_ns\n", 0);
+
+    for (iter = 1; iter <= ARCH_TEST_STORAGE_CRASH_ITERATIONS; iter++)
+    {
+        job.gen  = iter + 2;
+        delay_us = 1 + (crash_rand() % window_us);
+
+        status = val->run_killable(crash_writer, &job, delay_us, &completed);
+        TEST_ASSERT_EQUAL(status, VAL_STATUS_SUCCESS, TEST_CHECKPOINT_NUM(10));
+
+        status = crash_recover(fCode, job.gen, &new_count, &recovery_ns);
+        if (status != VAL_STATUS_SUCCESS)
+        {
+            val->print(PRINT_ERROR, "\tTorn data after a kill at %d us\n", (int32_t)delay_us);
+            return status;
+        }
+
+        /* The writer cannot be killed after it has written every UID */
+        if (completed)
+            TEST_ASSERT_EQUAL(new_count, CRASH_UID_COUNT, TEST_CHECKPOINT_NUM(11));
+        else
+            killed++;
+        if (new_count && (new_count != CRASH_UID_COUNT))
+            partial++;
+
+        recovery_total += recovery_ns;
+        if (recovery_ns > recovery_max)
+            recovery_max = recovery_ns;
+
+        val->print(PRINT_TEST, "[Series] %d,", (int32_t)iter);
+        val->print(PRINT_TEST, "%d,", (int32_t)delay_us);
+        val->print(PRINT_TEST, "%d,", (int32_t)!completed);
+        val->print(PRINT_TEST, "%d,", (int32_t)new_count);
+        val->print(PRINT_TEST, "%d,", (int32_t)(CRASH_UID_COUNT - new_count));
+        val->print(PRINT_TEST, "%d\n", (recovery_ns > INT_MAX) ? INT_MAX : (int32_t)recovery_ns);
+    }
+
+    val->print(PRINT_TEST, "[Info] Writer killed in %d iterations,", (int32_t)killed);
+    val->print(PRINT_TEST, " %d of them mid sequence\n", (int32_t)partial);
+    val->print(PRINT_TEST, "[Info] Recovery scan avg %d ns,",
+               (int32_t)(recovery_total / ARCH_TEST_STORAGE_CRASH_ITERATIONS));
+    val->print(PRINT_TEST, " max %d ns\n", (recovery_max > INT_MAX) ? INT_MAX : (int32_t)recovery_max);
+
+    val->print(PRINT_TEST, "[Check 3] Remove the UIDs\n", 0);
+    return crash_remove(fCode);
+}
+
+int32_t s020_storage_test(caller_security_t caller __UNUSED)
+{
+    int32_t  status;
+    uint32_t completed;
+
+    if (val->run_killable(NULL, NULL, 0, &completed) == VAL_STATUS_UNSUPPORTED)
+    {
+        val->print(PRINT_TEST, "[Info] Platform cannot kill a client, test skipped\n", 0);
+        return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+    }
+
+#if defined(STORAGE) || defined(INTERNAL_TRUSTED_STORAGE)
+    val->print(PRINT_TEST, ITS_TEST_MESSAGE, 0);
+    status = psa_sst_crash_consistency(VAL_ITS_FUNCTION);
+    if (status != VAL_STATUS_SUCCESS) {
+        return status;
+    }
+#endif
+
+#if defined(STORAGE) || defined(PROTECTED_STORAGE)
+    val->print(PRINT_TEST, PS_TEST_MESSAGE, 0);
+    status = psa_sst_crash_consistency(VAL_PS_FUNCTION);
+    if (status != VAL_STATUS_SUCCESS) {
+        return status;
+    }
+#endif
+
+    return VAL_STATUS_SUCCESS;
+}
@@ -0,0 +1,202 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_interfaces.h"
+#include "val_target.h"
+#include "test_s021.h"
+#include "test_data.h"
+
+/* Scan profile, can be tuned by the platform in pal_storage_config.h */
+#ifndef ARCH_TEST_STORAGE_SCAN_MIN_UIDS
+#define ARCH_TEST_STORAGE_SCAN_MIN_UIDS   16
+#endif
+#ifndef ARCH_TEST_STORAGE_SCAN_MAX_UIDS
+#define ARCH_TEST_STORAGE_SCAN_MAX_UIDS   1024
+#endif
+#ifndef ARCH_TEST_STORAGE_SCAN_UID_SIZE
+#define ARCH_TEST_STORAGE_SCAN_UID_SIZE   16
+#endif
+
+/* The UID count doubles every step, starting from zero it would never grow */
+#if ARCH_TEST_STORAGE_SCAN_MIN_UIDS < 1
+#error "ARCH_TEST_STORAGE_SCAN_MIN_UIDS must be at least 1"
+#endif
+
+#define TEST_BASE_UID_VALUE   (UID_BASE_VALUE + 5)
+
+const client_test_t s021_storage_test_list[] = {
+    NULL,
+    s021_storage_test,
+    NULL,
+};
+
+static uint8_t  write_buff[ARCH_TEST_STORAGE_SCAN_UID_SIZE];
+static uint32_t latency_ns[ARCH_TEST_STORAGE_SCAN_MAX_UIDS];
+
+static uint64_t scan_timestamp(void)
+{
+    uint64_t timestamp = 0;
+
+    if (val->get_timestamp(&timestamp) != VAL_STATUS_SUCCESS)
+        timestamp = 0;
+    return timestamp;
+}
+
+static int32_t scan_ns_to_print(uint64_t ns)
+{
+    return (ns > INT_MAX) ? INT_MAX : (int32_t)ns;
+}
+
+/* Shell sort, the latencies are only ordered to read the percentiles */
+static void scan_sort(uint32_t *data, uint32_t count)
+{
+    uint32_t gap, i, j, value;
+
+    for (gap = count / 2; gap > 0; gap /= 2)
+    {
+        for (i = gap; i < count; i++)
+        {
+            value = data[i];
+            for (j = i; (j >= gap) && (data[j - gap] > value); j -= gap)
+                data[j] = data[j - gap];
+            data[j] = value;
+        }
+    }
+}
+
+/* Calls get_info on the first count UIDs, in UID order as an index rebuild would */
+static int32_t scan_uids(storage_function_code_t fCode, uint32_t count, uint64_t *total_ns)
+{
+    int32_t                   status;
+    uint32_t                  idx;
+    struct psa_storage_info_t info = {0};
+    uint64_t                  start, scan_start, elapsed;
+
+    scan_start = scan_timestamp();
+    for (idx = 0; idx < count; idx++)
+    {
+        start   = scan_timestamp();
+        status  = STORAGE_FUNCTION(s021_data[VAL_TEST_IDX2].api[fCode], TEST_BASE_UID_VALUE + idx,
+                                   &info);
+        elapsed = scan_timestamp() - start;
+        TEST_ASSERT_EQUAL(status, s021_data[VAL_TEST_IDX2].status, TEST_CHECKPOINT_NUM(2));
+        TEST_ASSERT_EQUAL(info.size, ARCH_TEST_STORAGE_SCAN_UID_SIZE, TEST_CHECKPOINT_NUM(3));
+        TEST_ASSERT_EQUAL(info.flags, PSA_STORAGE_FLAG_NONE, TEST_CHECKPOINT_NUM(4));
+
+        latency_ns[idx] = (elapsed > UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsed;
+    }
+    *total_ns = scan_timestamp() - scan_start;
+    return VAL_STATUS_SUCCESS;
+}
+
+static int32_t psa_sst_bulk_scan(storage_function_code_t fCode)
+{
+    int32_t  status = PSA_SUCCESS;
+    uint32_t populated = 0, scanned = 0, target, idx;
+    uint64_t total_ns, avg_ns, base_avg_ns = 0;
+    uint32_t full = 0;
+
+    val->print(PRINT_TEST, "[Check 1] get_info scan of %d", ARCH_TEST_STORAGE_SCAN_MIN_UIDS);
+    val->print(PRINT_TEST, " to %d UIDs", ARCH_TEST_STORAGE_SCAN_MAX_UIDS);
+    val->print(PRINT_TEST, " of %d bytes\n", ARCH_TEST_STORAGE_SCAN_UID_SIZE);
+    val->print(PRINT_TEST, "[Series] uids,total_ns,avg_ns,p50_ns,p99_ns,max_ns,avg_growth_pct\n", 0);
+
+    for (target = ARCH_TEST_STORAGE_SCAN_MIN_UIDS; !full; target *= 2)
+    {
+        if (target >= ARCH_TEST_STORAGE_SCAN_MAX_UIDS)
+        {
+            target = ARCH_TEST_STORAGE_SCAN_MAX_UIDS;
+            full   = 1;
+        }
+
+        /* UIDs are added on top of the previous step, the storage only grows */
+        for (; populated < target; populated++)
+        {
+            memset(write_buff, (uint8_t)populated, sizeof(write_buff));
+            status = STORAGE_FUNCTION(s021_data[VAL_TEST_IDX1].api[fCode],
+                                      TEST_BASE_UID_VALUE + populated,
+                                      ARCH_TEST_STORAGE_SCAN_UID_SIZE, write_buff,
+                                      PSA_STORAGE_FLAG_NONE);
+            if (status != PSA_SUCCESS)
+                break;
+        }
+        if (status != PSA_SUCCESS)
+        {
+            TEST_ASSERT_EQUAL(status, s021_data[VAL_TEST_IDX1].status, TEST_CHECKPOINT_NUM(1));
+            val->print(PRINT_TEST, "[Info] Storage full at %d UIDs\n", (int32_t)populated);
+            full = 1;
+        }
+
+        /* A storage full before the step grew repeats the previous row, skip it */
+        if (populated == scanned)
+            break;
+
+        status = scan_uids(fCode, populated, &total_ns);
+        if (status != VAL_STATUS_SUCCESS)
+            return status;
+        scanned = populated;
+
+        avg_ns = total_ns / populated;
+        if (!base_avg_ns)
+            base_avg_ns = avg_ns;
+        scan_sort(latency_ns, populated);
+
+        val->print(PRINT_TEST, "[Series] %d,", (int32_t)populated);
+        val->print(PRINT_TEST, "%d,", scan_ns_to_print(total_ns));
+        val->print(PRINT_TEST, "%d,", scan_ns_to_print(avg_ns));
+        val->print(PRINT_TEST, "%d,", scan_ns_to_print(latency_ns[populated / 2]));
+        val->print(PRINT_TEST, "%d,", scan_ns_to_print(latency_ns[(populated * 99) / 100]));
+        val->print(PRINT_TEST, "%d,", scan_ns_to_print(latency_ns[populated - 1]));
+        val->print(PRINT_TEST, "%d\n", base_avg_ns ? (int32_t)((avg_ns * 100) / base_avg_ns) : 0);
+    }
+
+    val->print(PRINT_TEST, "[Check 2] Remove the %d UIDs\n", (int32_t)populated);
+    for (idx = 0; idx < populated; idx++)
+    {
+        status = STORAGE_FUNCTION(s021_data[VAL_TEST_IDX3].api[fCode], TEST_BASE_UID_VALUE + idx);
+        TEST_ASSERT_EQUAL(status, s021_data[VAL_TEST_IDX3].status, TEST_CHECKPOINT_NUM(5));
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+int32_t s021_storage_test(caller_security_t caller __UNUSED)
+{
+    int32_t  status;
+    uint64_t timestamp;
+
+    if (val->get_timestamp(&timestamp) != VAL_STATUS_SUCCESS)
+        val->print(PRINT_TEST, "[Info] No platform timestamp, latencies are reported as 0\n", 0);
+
+#if defined(STORAGE) || defined(INTERNAL_TRUSTED_STORAGE)
+    val->print(PRINT_TEST, ITS_TEST_MESSAGE, 0);
+    status = psa_sst_bulk_scan(VAL_ITS_FUNCTION);
+    if (status != VAL_STATUS_SUCCESS) {
+        return status;
+    }
+#endif
+
+#if defined(STORAGE) || defined(PROTECTED_STORAGE)
+    val->print(PRINT_TEST, PS_TEST_MESSAGE, 0);
+    status = psa_sst_bulk_scan(VAL_PS_FUNCTION);
+    if (status != VAL_STATUS_SUCCESS) {
+        return status;
+    }
+#endif
+
+    return VAL_STATUS_SUCCESS;
+}
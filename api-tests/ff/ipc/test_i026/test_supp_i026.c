@@ -36,10 +36,9 @@ const server_test_t test_i026_server_tests_list[] = {
 int32_t server_test_psa_call_with_iovec_more_than_max_limit(void)
 {
     psa_msg_t       msg = {0};
-    psa_signal_t    signals;
 
 wait:
-    signals = psa->wait(PSA_WAIT_ANY, PSA_BLOCK);
+    psa->wait(PSA_WAIT_ANY, PSA_BLOCK);
     if (psa->get(SERVER_UNSPECIFIED_VERSION_SIGNAL, &msg) != PSA_SUCCESS)
     {
 	goto wait;
@@ -66,8 +66,8 @@ int32_t client_test_instr_exec_from_writable_mem(caller_security_t caller __UNUS
 
   /* Point function pointer to data memory */
   fptr = (fptr_t) opcode;
-  val->print(PRINT_DEBUG, "\t&opcode = 0x%x\n", (uint32_t) &opcode);
-  val->print(PRINT_DEBUG, "\tfptr = 0x%x\n", (uint32_t) fptr);
+  val->print(PRINT_DEBUG, "\t&opcode = 0x%x\n", (uint32_t)(uintptr_t) &opcode);
+  val->print(PRINT_DEBUG, "\tfptr = 0x%x\n", (uint32_t)(uintptr_t) fptr);
 
   /* Setting boot.state before test check */
    if (val->set_boot_flag(BOOT_EXPECTED_S))
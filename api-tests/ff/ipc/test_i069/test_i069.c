@@ -49,7 +49,7 @@ int32_t client_test_write_to_code_space(caller_security_t caller __UNUSED)
   /* Check - Write to code memory. This should generate internal fault */
   *p = 0x0;
 
-  if (*p == (int32_t)client_test_write_to_code_space)
+  if (*p == (int32_t)(uintptr_t)client_test_write_to_code_space)
   {
       /* This means, write ignored */
       return VAL_STATUS_SUCCESS;
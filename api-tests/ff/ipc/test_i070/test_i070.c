@@ -46,8 +46,8 @@ int32_t client_test_write_to_const_data(caller_security_t caller __UNUSED)
    }
 
   p = (char *) string;
-  val->print(PRINT_DEBUG, "\tstring[0] = 0x%x\n", (uint32_t) string);
-  val->print(PRINT_DEBUG, "\tp[0] = 0x%x\n", (uint32_t) p);
+  val->print(PRINT_DEBUG, "\tstring[0] = 0x%x\n", (uint32_t)(uintptr_t) string);
+  val->print(PRINT_DEBUG, "\tp[0] = 0x%x\n", (uint32_t)(uintptr_t) p);
 
   /*
    * Check - Write to const data string[0].
@@ -37,7 +37,7 @@ const server_test_t test_i073_server_tests_list[] = {
     NULL,
 };
 
-static int32_t send_secure_partition_address(addr_t *stack)
+static int32_t send_secure_partition_address(uint32_t *stack)
 {
     int32_t         status = VAL_STATUS_SUCCESS;
     psa_msg_t       msg = {0};
@@ -49,10 +49,10 @@ static int32_t send_secure_partition_address(addr_t *stack)
         return status;
     }
 
-    val->print(PRINT_DEBUG, "\tAPP-ROT: Passing 0x%x to NSPE\n", (int)stack);
+    val->print(PRINT_DEBUG, "\tAPP-ROT: Passing 0x%x to NSPE\n", (uint32_t)(uintptr_t)stack);
 
     /* Send Application RoT stack address */
-    psa->write(msg.handle, 0, (void *)&stack, sizeof(uint32_t));
+    psa->write(msg.handle, 0, (void *)&stack, sizeof(stack));
     psa->reply(msg.handle, PSA_SUCCESS);
 
     return VAL_STATUS_SUCCESS;
@@ -105,7 +105,7 @@ const server_test_t test_i073_server_tests_list[] = {
     NULL,
 };
 
-static int32_t send_secure_partition_address(addr_t *stack)
+static int32_t send_secure_partition_address(uint32_t *stack)
 {
     int32_t         status = VAL_STATUS_SUCCESS;
     psa_msg_t       msg = {0};
@@ -126,10 +126,10 @@ static int32_t send_secure_partition_address(addr_t *stack)
         return status;
     }
 
-    val->print(PRINT_DEBUG, "\tAPP-ROT: Passing 0x%x to NSPE\n", (int)stack);
+    val->print(PRINT_DEBUG, "\tAPP-ROT: Passing 0x%x to NSPE\n", (uint32_t)(uintptr_t)stack);
 
     /* Send Application RoT stack address */
-    psa->write(msg.handle, 0, (void *)&stack, sizeof(uint32_t));
+    psa->write(msg.handle, 0, (void *)&stack, sizeof(stack));
     psa->reply(msg.handle, PSA_SUCCESS);
 
     status = val->process_disconnect_request(SERVER_UNSPECIFIED_VERSION_SIGNAL, &msg);
@@ -71,7 +71,7 @@ static int32_t send_secure_partition_address(addr_t *addr)
     val->print(PRINT_DEBUG, "\tAPP-ROT: Passing 0x%x to NSPE\n", (int)*addr);
 
     /* Send Application RoT mmio address */
-    psa->write(msg.handle, 0, (void *)addr, sizeof(uint32_t));
+    psa->write(msg.handle, 0, (void *)addr, sizeof(addr_t));
     psa->reply(msg.handle, PSA_SUCCESS);
 
     return VAL_STATUS_SUCCESS;
@@ -175,7 +175,7 @@ static int32_t send_secure_partition_address(addr_t *addr)
     val->print(PRINT_DEBUG, "\tAPP-ROT: Passing 0x%x to NSPE\n", (int)*addr);
 
     /* Send Application RoT mmio address */
-    psa->write(msg.handle, 0, (void *)addr, sizeof(uint32_t));
+    psa->write(msg.handle, 0, (void *)addr, sizeof(addr_t));
     psa->reply(msg.handle, PSA_SUCCESS);
 
     status = val->process_disconnect_request(SERVER_UNSPECIFIED_VERSION_SIGNAL, &msg);
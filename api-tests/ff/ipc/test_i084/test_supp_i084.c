@@ -53,7 +53,7 @@ static int32_t send_secure_partition_address(void)
         return status;
     }
 
-    val->print(PRINT_DEBUG, "\tServer SP: Passing 0x%x to Client SP\n", (int)&g_test_i084);
+    val->print(PRINT_DEBUG, "\tServer SP: Passing 0x%x to Client SP\n", (uint32_t)(uintptr_t)&g_test_i084);
 
     /* Send Application RoT data address - global variable */
     psa->write(msg.handle, 0, (void *)&addr, sizeof(addr));
@@ -122,7 +122,7 @@ static int32_t send_secure_partition_address(void)
         return status;
     }
 
-    val->print(PRINT_DEBUG, "\tServer SP: Passing 0x%x to Client SP\n", (int)&g_test_i084);
+    val->print(PRINT_DEBUG, "\tServer SP: Passing 0x%x to Client SP\n", (uint32_t)(uintptr_t)&g_test_i084);
 
     /* Send Application RoT data address - global variable */
     psa->write(msg.handle, 0, (void *)&addr, sizeof(addr));
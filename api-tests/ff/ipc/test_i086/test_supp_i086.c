@@ -56,10 +56,10 @@ static int32_t send_secure_partition_address(uint8_t *heap)
         return status;
     }
 
-    val->print(PRINT_DEBUG, "\tServer SP: Passing 0x%x to Client SP\n", (int)heap);
+    val->print(PRINT_DEBUG, "\tServer SP: Passing 0x%x to Client SP\n", (uint32_t)(uintptr_t)heap);
 
     /* Send Application RoT heap address */
-    psa->write(msg.handle, 0, (void *)&heap, sizeof(BUFFER_SIZE));
+    psa->write(msg.handle, 0, (void *)&heap, sizeof(heap));
     psa->reply(msg.handle, PSA_SUCCESS);
 
     return VAL_STATUS_SUCCESS;
@@ -154,10 +154,10 @@ static int32_t send_secure_partition_address(uint8_t *heap)
         return status;
     }
 
-    val->print(PRINT_DEBUG, "\tServer SP: Passing 0x%x to Client SP\n", (int)heap);
+    val->print(PRINT_DEBUG, "\tServer SP: Passing 0x%x to Client SP\n", (uint32_t)(uintptr_t)heap);
 
     /* Send Application RoT heap address */
-    psa->write(msg.handle, 0, (void *)&heap, sizeof(BUFFER_SIZE));
+    psa->write(msg.handle, 0, (void *)&heap, sizeof(heap));
     psa->reply(msg.handle, PSA_SUCCESS);
 
     status = val->process_disconnect_request(SERVER_UNSPECIFIED_VERSION_SIGNAL, &msg);
@@ -0,0 +1,42 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _TEST_I091_DATA_H_
+#define _TEST_I091_DATA_H_
+
+/* Round trips per vector size, can be tuned by the platform in pal_config.h */
+#ifndef ARCH_TEST_IPC_BENCH_ITERATIONS
+#define ARCH_TEST_IPC_BENCH_ITERATIONS  32
+#endif
+
+/* Bytes moved per psa_read/psa_write by the echo service */
+#ifndef ARCH_TEST_IPC_BENCH_CHUNK_SIZE
+#define ARCH_TEST_IPC_BENCH_CHUNK_SIZE  128
+#endif
+
+#define IPC_BENCH_MAX_VEC_SIZE          4096
+
+/* {invec size, outvec size} of each measured row. The service echoes the invec
+ * into the outvec and pads the rest of the outvec with zeros.
+ */
+#define IPC_BENCH_VEC_SIZES             {{0, 0}, {16, 16}, {64, 64}, {256, 256}, \
+                                         {1024, 1024}, {IPC_BENCH_MAX_VEC_SIZE, 0}, \
+                                         {0, IPC_BENCH_MAX_VEC_SIZE}, \
+                                         {IPC_BENCH_MAX_VEC_SIZE, IPC_BENCH_MAX_VEC_SIZE}}
+#define IPC_BENCH_NUM_VEC_SIZES         8
+
+#endif /* _TEST_I091_DATA_H_ */
@@ -0,0 +1,236 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifdef NONSECURE_TEST_BUILD
+#include "val_interfaces.h"
+#include "val_target.h"
+#else
+#include "val_client_defs.h"
+#include "val_service_defs.h"
+#endif
+
+#include "test_i091.h"
+#include "test_data.h"
+
+#ifdef NONSECURE_TEST_BUILD
+
+const client_test_t test_i091_client_tests_list[] = {
+    NULL,
+    client_test_ipc_round_trip_latency,
+    NULL,
+};
+
+typedef struct {
+    uint32_t in_size;
+    uint32_t out_size;
+} ipc_bench_sizes_t;
+
+static const ipc_bench_sizes_t ipc_bench_sizes[IPC_BENCH_NUM_VEC_SIZES] = IPC_BENCH_VEC_SIZES;
+
+static uint8_t     ipc_bench_in[IPC_BENCH_MAX_VEC_SIZE];
+static uint8_t     ipc_bench_out[IPC_BENCH_MAX_VEC_SIZE];
+static uint32_t    connect_latency_ns[ARCH_TEST_IPC_BENCH_ITERATIONS];
+static uint32_t    call_latency_ns[ARCH_TEST_IPC_BENCH_ITERATIONS];
+static uint32_t    close_latency_ns[ARCH_TEST_IPC_BENCH_ITERATIONS];
+static uint32_t    round_trip_latency_ns[ARCH_TEST_IPC_BENCH_ITERATIONS];
+
+static uint64_t ipc_timestamp(void)
+{
+    uint64_t timestamp = 0;
+
+    if (val->get_timestamp(&timestamp) != VAL_STATUS_SUCCESS)
+        timestamp = 0;
+    return timestamp;
+}
+
+static uint32_t ipc_elapsed(uint64_t start, uint64_t end)
+{
+    uint64_t elapsed = end - start;
+
+    return (elapsed > UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsed;
+}
+
+static int32_t ipc_ns_to_print(uint64_t ns)
+{
+    return (ns > INT32_MAX) ? INT32_MAX : (int32_t)ns;
+}
+
+/* Shell sort, the latencies are only ordered to read the percentiles */
+static void ipc_sort(uint32_t *data, uint32_t count)
+{
+    uint32_t gap, i, j, value;
+
+    for (gap = count / 2; gap > 0; gap /= 2)
+    {
+        for (i = gap; i < count; i++)
+        {
+            value = data[i];
+            for (j = i; (j >= gap) && (data[j - gap] > value); j -= gap)
+                data[j] = data[j - gap];
+            data[j] = value;
+        }
+    }
+}
+
+/**
+    @brief    - Checks the outvec holds the echoed invec followed by zeros
+    @param    - sizes : Vector sizes of the call
+                row   : Row number, seeds the invec pattern
+                len   : Outvec length returned by psa_call
+    @return   - val_status_t
+**/
+static int32_t ipc_check_echo(const ipc_bench_sizes_t *sizes, uint32_t row, size_t len)
+{
+    uint32_t i;
+    uint8_t  expected;
+
+    if (len != sizes->out_size)
+    {
+        val->print(PRINT_ERROR, "\tUnexpected outvec length %d\n", (int32_t)len);
+        return VAL_STATUS_WRITE_FAILED;
+    }
+
+    for (i = 0; i < sizes->out_size; i++)
+    {
+        expected = (i < sizes->in_size) ? (uint8_t)(i + row) : 0;
+        if (ipc_bench_out[i] != expected)
+        {
+            val->print(PRINT_ERROR, "\tOutvec mismatch at offset %d\n", (int32_t)i);
+            return VAL_STATUS_WRITE_FAILED;
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+int32_t client_test_ipc_round_trip_latency(caller_security_t caller __UNUSED)
+{
+    int32_t                 status = VAL_STATUS_SUCCESS;
+    const ipc_bench_sizes_t *sizes;
+    psa_handle_t            handle = 0;
+    uint32_t                row, iter, i;
+    uint32_t                p50 = ARCH_TEST_IPC_BENCH_ITERATIONS / 2;
+    uint32_t                p99 = (ARCH_TEST_IPC_BENCH_ITERATIONS * 99) / 100;
+    uint64_t                t0, t1, t2, t3, total_ns;
+
+    val->print(PRINT_TEST, "[Check 1] Test psa_call round trip latency across vector sizes\n", 0);
+
+    if (val->get_timestamp(&t0) != VAL_STATUS_SUCCESS)
+        val->print(PRINT_TEST, "[Info] No platform timestamp, latencies are reported as 0\n", 0);
+
+    val->print(PRINT_TEST, "[Info] Round trips per vector size %d\n",
+               ARCH_TEST_IPC_BENCH_ITERATIONS);
+    val->print(PRINT_TEST, "[Series] handle,in_size,out_size,connect_p50_ns,call_p50_ns,"
+               "call_p99_ns,call_max_ns,close_p50_ns,round_trip_p50_ns,round_trip_p99_ns,"
+               "round_trips_per_sec\n", 0);
+
+    for (row = 0; row < IPC_BENCH_NUM_VEC_SIZES; row++)
+    {
+        sizes = &ipc_bench_sizes[row];
+        total_ns = 0;
+
+        for (i = 0; i < sizes->in_size; i++)
+            ipc_bench_in[i] = (uint8_t)(i + row);
+
+        for (iter = 0; iter < ARCH_TEST_IPC_BENCH_ITERATIONS; iter++)
+        {
+            psa_invec  invec[1]  = {{ipc_bench_in, sizes->in_size}};
+            psa_outvec outvec[1] = {{ipc_bench_out, sizes->out_size}};
+
+            memset(ipc_bench_out, 0xFF, sizes->out_size);
+
+#if STATELESS_ROT == 1
+            /* Stateless RoT services have a static handle, no connect and close */
+            t0 = ipc_timestamp();
+            handle = SERVER_UNSPECIFIED_VERSION_HANDLE;
+            t1 = t0;
+            status = val->ipc_call(handle, PSA_IPC_CALL, invec, 1, outvec, 1);
+            t2 = ipc_timestamp();
+            t3 = t2;
+#else
+            t0 = ipc_timestamp();
+            if (val->ipc_connect(SERVER_UNSPECIFIED_VERSION_SID,
+                                 SERVER_UNSPECIFIED_VERSION_VERSION,
+                                 &handle))
+            {
+                val->print(PRINT_ERROR, "\tConnection failed\n", 0);
+                return VAL_STATUS_CONNECTION_FAILED;
+            }
+            t1 = ipc_timestamp();
+            status = val->ipc_call(handle, PSA_IPC_CALL, invec, 1, outvec, 1);
+            t2 = ipc_timestamp();
+            val->ipc_close(handle);
+            t3 = ipc_timestamp();
+#endif
+
+            if (VAL_ERROR(status))
+            {
+                val->print(PRINT_ERROR, "\tpsa_call failed for in_size %d\n",
+                           (int32_t)sizes->in_size);
+                return VAL_STATUS_CALL_FAILED;
+            }
+
+            status = ipc_check_echo(sizes, row, outvec[0].len);
+            if (VAL_ERROR(status))
+                return status;
+
+            connect_latency_ns[iter]    = ipc_elapsed(t0, t1);
+            call_latency_ns[iter]       = ipc_elapsed(t1, t2);
+            close_latency_ns[iter]      = ipc_elapsed(t2, t3);
+            round_trip_latency_ns[iter] = ipc_elapsed(t0, t3);
+            total_ns += round_trip_latency_ns[iter];
+        }
+
+        ipc_sort(connect_latency_ns, ARCH_TEST_IPC_BENCH_ITERATIONS);
+        ipc_sort(call_latency_ns, ARCH_TEST_IPC_BENCH_ITERATIONS);
+        ipc_sort(close_latency_ns, ARCH_TEST_IPC_BENCH_ITERATIONS);
+        ipc_sort(round_trip_latency_ns, ARCH_TEST_IPC_BENCH_ITERATIONS);
+
+#if STATELESS_ROT == 1
+        val->print(PRINT_TEST, "[Series] stateless,", 0);
+#else
+        val->print(PRINT_TEST, "[Series] connection,", 0);
+#endif
+        val->print(PRINT_TEST, "%d,", (int32_t)sizes->in_size);
+        val->print(PRINT_TEST, "%d,", (int32_t)sizes->out_size);
+        val->print(PRINT_TEST, "%d,", ipc_ns_to_print(connect_latency_ns[p50]));
+        val->print(PRINT_TEST, "%d,", ipc_ns_to_print(call_latency_ns[p50]));
+        val->print(PRINT_TEST, "%d,", ipc_ns_to_print(call_latency_ns[p99]));
+        val->print(PRINT_TEST, "%d,",
+                   ipc_ns_to_print(call_latency_ns[ARCH_TEST_IPC_BENCH_ITERATIONS - 1]));
+        val->print(PRINT_TEST, "%d,", ipc_ns_to_print(close_latency_ns[p50]));
+        val->print(PRINT_TEST, "%d,", ipc_ns_to_print(round_trip_latency_ns[p50]));
+        val->print(PRINT_TEST, "%d,", ipc_ns_to_print(round_trip_latency_ns[p99]));
+        val->print(PRINT_TEST, "%d\n", total_ns ?
+                   ipc_ns_to_print((1000000000ull * ARCH_TEST_IPC_BENCH_ITERATIONS) /
+                                   total_ns) : 0);
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+#else
+
+/* The round trips are timed with the non-secure platform timestamp, the secure
+ * client partition has no timestamp and does not run this test.
+ */
+const client_test_t test_i091_client_tests_list[] = {
+    NULL,
+    NULL,
+};
+
+#endif
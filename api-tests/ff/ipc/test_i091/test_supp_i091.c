@@ -0,0 +1,126 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_client_defs.h"
+#include "val_service_defs.h"
+#include "test_data.h"
+
+#define val CONCAT(val, _server_sp)
+#define psa CONCAT(psa, _server_sp)
+extern val_api_t *val;
+extern psa_api_t *psa;
+
+int32_t server_test_ipc_round_trip_latency(void);
+
+const server_test_t test_i091_server_tests_list[] = {
+    NULL,
+    server_test_ipc_round_trip_latency,
+    NULL,
+};
+
+static uint8_t ipc_bench_chunk[ARCH_TEST_IPC_BENCH_CHUNK_SIZE];
+
+/**
+    @brief    - Echoes invec 0 into outvec 0 a chunk at a time and pads the rest
+                of the outvec with zeros, so that any vector size fits the stack
+                and the static chunk of the partition
+    @param    - msg : Call message
+    @return   - val_status_t
+**/
+static int32_t ipc_bench_echo(psa_msg_t *msg)
+{
+    size_t in_size = msg->in_size[0], out_size = msg->out_size[0];
+    size_t offset, len;
+
+    for (offset = 0; offset < out_size; offset += len)
+    {
+        len = out_size - offset;
+        if (len > sizeof(ipc_bench_chunk))
+            len = sizeof(ipc_bench_chunk);
+
+        if (offset < in_size)
+        {
+            if (len > in_size - offset)
+                len = in_size - offset;
+            if (psa->read(msg->handle, 0, ipc_bench_chunk, len) != len)
+                return VAL_STATUS_READ_FAILED;
+        }
+        else
+        {
+            memset(ipc_bench_chunk, 0, len);
+        }
+        psa->write(msg->handle, 0, ipc_bench_chunk, len);
+    }
+
+    /* Input beyond the outvec is still consumed, as a write-only service would */
+    for (offset = out_size; offset < in_size; offset += len)
+    {
+        len = in_size - offset;
+        if (len > sizeof(ipc_bench_chunk))
+            len = sizeof(ipc_bench_chunk);
+        if (psa->read(msg->handle, 0, ipc_bench_chunk, len) != len)
+            return VAL_STATUS_READ_FAILED;
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+int32_t server_test_ipc_round_trip_latency(void)
+{
+    int32_t         status = VAL_STATUS_SUCCESS;
+    psa_msg_t       msg = {0};
+    uint32_t        calls;
+
+    for (calls = 0; calls < IPC_BENCH_NUM_VEC_SIZES * ARCH_TEST_IPC_BENCH_ITERATIONS; calls++)
+    {
+#if STATELESS_ROT != 1
+        status = val->process_connect_request(SERVER_UNSPECIFIED_VERSION_SIGNAL, &msg);
+        if (val->err_check_set(TEST_CHECKPOINT_NUM(201), status))
+        {
+            psa->reply(msg.handle, PSA_ERROR_CONNECTION_REFUSED);
+            return status;
+        }
+        psa->reply(msg.handle, PSA_SUCCESS);
+#endif
+
+        status = val->process_call_request(SERVER_UNSPECIFIED_VERSION_SIGNAL, &msg);
+        if (val->err_check_set(TEST_CHECKPOINT_NUM(202), status))
+        {
+            psa->reply(msg.handle, -2);
+            return status;
+        }
+
+        status = ipc_bench_echo(&msg);
+        if (val->err_check_set(TEST_CHECKPOINT_NUM(203), status))
+        {
+            psa->reply(msg.handle, -3);
+            return status;
+        }
+        psa->reply(msg.handle, PSA_SUCCESS);
+
+#if STATELESS_ROT != 1
+        status = val->process_disconnect_request(SERVER_UNSPECIFIED_VERSION_SIGNAL, &msg);
+        if (val->err_check_set(TEST_CHECKPOINT_NUM(204), status))
+        {
+            return status;
+        }
+        psa->reply(msg.handle, PSA_SUCCESS);
+#endif
+    }
+
+    return status;
+}
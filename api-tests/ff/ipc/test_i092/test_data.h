@@ -0,0 +1,46 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _TEST_I092_DATA_H_
+#define _TEST_I092_DATA_H_
+
+/* Calls per profiled row, can be tuned by the platform in pal_config.h */
+#ifndef ARCH_TEST_IPC_COPY_BENCH_ITERATIONS
+#define ARCH_TEST_IPC_COPY_BENCH_ITERATIONS  16
+#endif
+
+/* psa_call() type selecting the profiled Secure Partition API */
+#define IPC_COPY_OP_READ                0
+#define IPC_COPY_OP_SKIP                1
+#define IPC_COPY_OP_WRITE               2
+#define IPC_COPY_NUM_OPS                3
+
+/* Every row uses 1 to PSA_MAX_IOVEC vectors of one of these sizes, invecs for
+ * psa_read() and psa_skip(), outvecs for psa_write()
+ */
+#define IPC_COPY_MAX_VECS               4
+#define IPC_COPY_MAX_VEC_SIZE           1024
+#define IPC_COPY_VEC_SIZES              {16, 64, 256, IPC_COPY_MAX_VEC_SIZE}
+#define IPC_COPY_NUM_VEC_SIZES          4
+
+#define IPC_COPY_NUM_ROWS               (IPC_COPY_NUM_OPS * IPC_COPY_MAX_VECS * \
+                                         IPC_COPY_NUM_VEC_SIZES)
+
+/* Byte written by the service at offset i of outvec v */
+#define IPC_COPY_PATTERN(v, i)          ((uint8_t)(((v) << 6) + (i)))
+
+#endif /* _TEST_I092_DATA_H_ */
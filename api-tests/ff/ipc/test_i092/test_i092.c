@@ -0,0 +1,153 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifdef NONSECURE_TEST_BUILD
+#include "val_interfaces.h"
+#include "val_target.h"
+#else
+#include "val_client_defs.h"
+#include "val_service_defs.h"
+#endif
+
+#include "test_i092.h"
+#include "test_data.h"
+
+#ifdef NONSECURE_TEST_BUILD
+
+const client_test_t test_i092_client_tests_list[] = {
+    NULL,
+    client_test_ipc_copy_cost,
+    NULL,
+};
+
+static const uint32_t ipc_copy_sizes[IPC_COPY_NUM_VEC_SIZES] = IPC_COPY_VEC_SIZES;
+
+static uint8_t        ipc_copy_buf[IPC_COPY_MAX_VECS][IPC_COPY_MAX_VEC_SIZE];
+
+/**
+    @brief    - Checks the outvecs hold the pattern written by the service
+    @param    - outvec : Outvecs of the call
+                nvecs  : Number of outvecs
+                size   : Expected length of each outvec
+    @return   - val_status_t
+**/
+static int32_t ipc_copy_check(const psa_outvec *outvec, uint32_t nvecs, uint32_t size)
+{
+    uint32_t v, i;
+
+    for (v = 0; v < nvecs; v++)
+    {
+        if (outvec[v].len != size)
+        {
+            val->print(PRINT_ERROR, "\tUnexpected outvec length %d\n", (int32_t)outvec[v].len);
+            return VAL_STATUS_WRITE_FAILED;
+        }
+
+        for (i = 0; i < size; i++)
+        {
+            if (ipc_copy_buf[v][i] != IPC_COPY_PATTERN(v, i))
+            {
+                val->print(PRINT_ERROR, "\tOutvec mismatch at offset %d\n", (int32_t)i);
+                return VAL_STATUS_WRITE_FAILED;
+            }
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+int32_t client_test_ipc_copy_cost(caller_security_t caller __UNUSED)
+{
+    int32_t         status = VAL_STATUS_SUCCESS;
+    psa_handle_t    handle = 0;
+    psa_invec       invec[IPC_COPY_MAX_VECS];
+    psa_outvec      outvec[IPC_COPY_MAX_VECS];
+    uint32_t        op, nvecs, size_idx, size, iter, v;
+
+    val->print(PRINT_TEST, "[Check 1] Test psa_read, psa_skip and psa_write copy cost\n", 0);
+
+#if STATELESS_ROT == 1
+    /* Stateless RoT services have a static handle */
+    handle = SERVER_UNSPECIFIED_VERSION_HANDLE;
+#else
+    if (val->ipc_connect(SERVER_UNSPECIFIED_VERSION_SID,
+                         SERVER_UNSPECIFIED_VERSION_VERSION,
+                         &handle))
+    {
+        val->print(PRINT_ERROR, "\tConnection failed\n", 0);
+        return VAL_STATUS_CONNECTION_FAILED;
+    }
+#endif
+
+    /* The rows are sent in the order the service profiles them */
+    for (op = 0; op < IPC_COPY_NUM_OPS; op++)
+    {
+        for (nvecs = 1; nvecs <= IPC_COPY_MAX_VECS; nvecs++)
+        {
+            for (size_idx = 0; size_idx < IPC_COPY_NUM_VEC_SIZES; size_idx++)
+            {
+                size = ipc_copy_sizes[size_idx];
+                for (v = 0; v < nvecs; v++)
+                {
+                    memset(ipc_copy_buf[v], (op == IPC_COPY_OP_WRITE) ? 0xFF : (int)v, size);
+                    invec[v].base = ipc_copy_buf[v];
+                    invec[v].len = size;
+                    outvec[v].base = ipc_copy_buf[v];
+                    outvec[v].len = size;
+                }
+
+                for (iter = 0; iter < ARCH_TEST_IPC_COPY_BENCH_ITERATIONS; iter++)
+                {
+                    if (op == IPC_COPY_OP_WRITE)
+                        status = val->ipc_call(handle, (int32_t)op, NULL, 0, outvec, nvecs);
+                    else
+                        status = val->ipc_call(handle, (int32_t)op, invec, nvecs, NULL, 0);
+
+                    if (VAL_ERROR(status))
+                    {
+                        val->print(PRINT_ERROR, "\tpsa_call failed for type %d\n", (int32_t)op);
+                        status = VAL_STATUS_CALL_FAILED;
+                        goto exit;
+                    }
+
+                    if (op == IPC_COPY_OP_WRITE)
+                    {
+                        status = ipc_copy_check(outvec, nvecs, size);
+                        if (VAL_ERROR(status))
+                            goto exit;
+                    }
+                }
+            }
+        }
+    }
+
+exit:
+#if STATELESS_ROT != 1
+    val->ipc_close(handle);
+#endif
+    return status;
+}
+
+#else
+
+/* The vectors are only sent from the non-secure side */
+const client_test_t test_i092_client_tests_list[] = {
+    NULL,
+    NULL,
+};
+
+#endif
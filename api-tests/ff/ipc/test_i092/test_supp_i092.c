@@ -0,0 +1,292 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_client_defs.h"
+#include "val_service_defs.h"
+#include "test_data.h"
+
+#define val CONCAT(val, _server_sp)
+#define psa CONCAT(psa, _server_sp)
+extern val_api_t *val;
+extern psa_api_t *psa;
+
+int32_t server_test_ipc_copy_cost(void);
+
+const server_test_t test_i092_server_tests_list[] = {
+    NULL,
+    server_test_ipc_copy_cost,
+    NULL,
+};
+
+/* Calls timed for the cost of reading the timestamp, which is taken off every sample */
+#define IPC_COPY_TIMER_SAMPLES          16
+
+static const char *const ipc_copy_api_names[IPC_COPY_NUM_OPS] = {"psa_read", "psa_skip",
+                                                                  "psa_write"};
+static const uint32_t    ipc_copy_sizes[IPC_COPY_NUM_VEC_SIZES] = IPC_COPY_VEC_SIZES;
+
+static uint8_t   ipc_copy_buf[IPC_COPY_MAX_VEC_SIZE];
+static uint32_t  ipc_copy_cost_ns[ARCH_TEST_IPC_COPY_BENCH_ITERATIONS * IPC_COPY_MAX_VECS];
+static uint32_t  ipc_copy_p50_ns[IPC_COPY_NUM_ROWS];
+static uint32_t  ipc_copy_min_ns[IPC_COPY_NUM_ROWS];
+static uint64_t  ipc_copy_timer_ns;
+
+static uint64_t ipc_copy_timestamp(void)
+{
+    uint64_t timestamp = 0;
+
+    if (val->get_timestamp(&timestamp) != VAL_STATUS_SUCCESS)
+        timestamp = 0;
+    return timestamp;
+}
+
+static uint32_t ipc_copy_elapsed(uint64_t start, uint64_t end)
+{
+    uint64_t elapsed = end - start;
+
+    elapsed = (elapsed > ipc_copy_timer_ns) ? elapsed - ipc_copy_timer_ns : 0;
+    return (elapsed > UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsed;
+}
+
+static int32_t ipc_copy_to_print(uint64_t value)
+{
+    return (value > INT32_MAX) ? INT32_MAX : (int32_t)value;
+}
+
+/* Shell sort, the costs are only ordered to read the median */
+static void ipc_copy_sort(uint32_t *data, uint32_t count)
+{
+    uint32_t gap, i, j, value;
+
+    for (gap = count / 2; gap > 0; gap /= 2)
+    {
+        for (i = gap; i < count; i++)
+        {
+            value = data[i];
+            for (j = i; (j >= gap) && (data[j - gap] > value); j -= gap)
+                data[j] = data[j - gap];
+            data[j] = value;
+        }
+    }
+}
+
+/**
+    @brief    - Times the cost of reading the timestamp, as the smallest of
+                IPC_COPY_TIMER_SAMPLES back to back reads
+**/
+static void ipc_copy_calibrate(void)
+{
+    uint64_t start, end, elapsed, best = UINT64_MAX;
+    uint32_t i;
+
+    for (i = 0; i < IPC_COPY_TIMER_SAMPLES; i++)
+    {
+        start = ipc_copy_timestamp();
+        end = ipc_copy_timestamp();
+        elapsed = end - start;
+        if (elapsed < best)
+            best = elapsed;
+    }
+    ipc_copy_timer_ns = best;
+}
+
+/**
+    @brief    - Runs the profiled API once on every vector of a call message
+    @param    - msg     : Call message, its type selects the API
+                nvecs   : Expected number of vectors
+                size    : Expected size of each vector
+                cost_ns : Returns the cost of each API call
+    @return   - val_status_t
+**/
+static int32_t ipc_copy_profile(psa_msg_t *msg, uint32_t nvecs, uint32_t size, uint32_t *cost_ns)
+{
+    uint64_t start, end;
+    size_t   copied = 0;
+    uint32_t v, i, vec_size;
+
+    for (v = 0; v < IPC_COPY_MAX_VECS; v++)
+    {
+        vec_size = (msg->type == IPC_COPY_OP_WRITE) ? msg->out_size[v] : msg->in_size[v];
+        if (vec_size != ((v < nvecs) ? size : 0))
+        {
+            val->print(PRINT_ERROR, "\tUnexpected size of vector %d\n", (int32_t)v);
+            return VAL_STATUS_ERROR;
+        }
+    }
+
+    for (v = 0; v < nvecs; v++)
+    {
+        switch (msg->type)
+        {
+            case IPC_COPY_OP_READ:
+                start = ipc_copy_timestamp();
+                copied = psa->read(msg->handle, v, ipc_copy_buf, size);
+                end = ipc_copy_timestamp();
+                if ((ipc_copy_buf[0] != v) || (ipc_copy_buf[size - 1] != v))
+                    return VAL_STATUS_READ_FAILED;
+                break;
+            case IPC_COPY_OP_SKIP:
+                start = ipc_copy_timestamp();
+                copied = psa->skip(msg->handle, v, size);
+                end = ipc_copy_timestamp();
+                break;
+            case IPC_COPY_OP_WRITE:
+                for (i = 0; i < size; i++)
+                    ipc_copy_buf[i] = IPC_COPY_PATTERN(v, i);
+                start = ipc_copy_timestamp();
+                psa->write(msg->handle, v, ipc_copy_buf, size);
+                end = ipc_copy_timestamp();
+                copied = size;
+                break;
+            default:
+                val->print(PRINT_ERROR, "\tUnexpected call type %d\n", msg->type);
+                return VAL_STATUS_ERROR;
+        }
+
+        if (copied != size)
+            return VAL_STATUS_READ_FAILED;
+        cost_ns[v] = ipc_copy_elapsed(start, end);
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Prints the median cost of each row, then the fixed cost per call and
+                the cost per byte of each API, fitted on the single vector rows
+                between the smallest and the largest vector size
+**/
+static void ipc_copy_report(void)
+{
+    uint32_t op, nvecs, size_idx, row = 0, size, first, last;
+    uint32_t min_size = ipc_copy_sizes[0];
+    uint32_t max_size = ipc_copy_sizes[IPC_COPY_NUM_VEC_SIZES - 1];
+    uint64_t ps_per_byte;
+    int64_t  fixed_ns;
+
+    val->print(PRINT_TEST, "[Info] Timestamp cost taken off every call %d ns\n",
+               ipc_copy_to_print(ipc_copy_timer_ns));
+    val->print(PRINT_TEST, "[Series] api,vecs,size,p50_ns_per_call,min_ns_per_call,"
+               "p50_ps_per_byte\n", 0);
+    for (op = 0; op < IPC_COPY_NUM_OPS; op++)
+    {
+        for (nvecs = 1; nvecs <= IPC_COPY_MAX_VECS; nvecs++)
+        {
+            for (size_idx = 0; size_idx < IPC_COPY_NUM_VEC_SIZES; size_idx++, row++)
+            {
+                size = ipc_copy_sizes[size_idx];
+                val->print(PRINT_TEST, "[Series] ", 0);
+                val->print(PRINT_TEST, (char *)ipc_copy_api_names[op], 0);
+                val->print(PRINT_TEST, ",%d,", (int32_t)nvecs);
+                val->print(PRINT_TEST, "%d,", (int32_t)size);
+                val->print(PRINT_TEST, "%d,", ipc_copy_to_print(ipc_copy_p50_ns[row]));
+                val->print(PRINT_TEST, "%d,", ipc_copy_to_print(ipc_copy_min_ns[row]));
+                val->print(PRINT_TEST, "%d\n",
+                           ipc_copy_to_print((1000ull * ipc_copy_p50_ns[row]) / size));
+            }
+        }
+    }
+
+    val->print(PRINT_TEST, "[Series] api,fixed_ns_per_call,ps_per_byte\n", 0);
+    for (op = 0; op < IPC_COPY_NUM_OPS; op++)
+    {
+        /* Rows of a single vector start each API block */
+        first = ipc_copy_p50_ns[op * IPC_COPY_MAX_VECS * IPC_COPY_NUM_VEC_SIZES];
+        last = ipc_copy_p50_ns[(op * IPC_COPY_MAX_VECS * IPC_COPY_NUM_VEC_SIZES) +
+                               IPC_COPY_NUM_VEC_SIZES - 1];
+        ps_per_byte = (last > first) ? (1000ull * (last - first)) / (max_size - min_size) : 0;
+        fixed_ns = (int64_t)first - (int64_t)((ps_per_byte * min_size) / 1000);
+
+        val->print(PRINT_TEST, "[Series] ", 0);
+        val->print(PRINT_TEST, (char *)ipc_copy_api_names[op], 0);
+        val->print(PRINT_TEST, ",%d,", (fixed_ns > 0) ? ipc_copy_to_print((uint64_t)fixed_ns) : 0);
+        val->print(PRINT_TEST, "%d\n", ipc_copy_to_print(ps_per_byte));
+    }
+}
+
+int32_t server_test_ipc_copy_cost(void)
+{
+    int32_t         status = VAL_STATUS_SUCCESS;
+    psa_msg_t       msg = {0};
+    uint32_t        op, nvecs, size_idx, iter, row = 0, count;
+    uint64_t        timestamp;
+
+    if (val->get_timestamp(&timestamp) != VAL_STATUS_SUCCESS)
+        val->print(PRINT_TEST, "[Info] No partition timestamp, costs are reported as 0\n", 0);
+    ipc_copy_calibrate();
+
+#if STATELESS_ROT != 1
+    status = val->process_connect_request(SERVER_UNSPECIFIED_VERSION_SIGNAL, &msg);
+    if (val->err_check_set(TEST_CHECKPOINT_NUM(201), status))
+    {
+        psa->reply(msg.handle, PSA_ERROR_CONNECTION_REFUSED);
+        return status;
+    }
+    psa->reply(msg.handle, PSA_SUCCESS);
+#endif
+
+    for (op = 0; op < IPC_COPY_NUM_OPS; op++)
+    {
+        for (nvecs = 1; nvecs <= IPC_COPY_MAX_VECS; nvecs++)
+        {
+            for (size_idx = 0; size_idx < IPC_COPY_NUM_VEC_SIZES; size_idx++, row++)
+            {
+                count = 0;
+                for (iter = 0; iter < ARCH_TEST_IPC_COPY_BENCH_ITERATIONS; iter++)
+                {
+                    status = val->process_call_request(SERVER_UNSPECIFIED_VERSION_SIGNAL, &msg);
+                    if (val->err_check_set(TEST_CHECKPOINT_NUM(202), status))
+                    {
+                        psa->reply(msg.handle, -2);
+                        return status;
+                    }
+
+                    if (msg.type != (int32_t)op)
+                        status = VAL_STATUS_ERROR;
+                    else
+                        status = ipc_copy_profile(&msg, nvecs, ipc_copy_sizes[size_idx],
+                                                  &ipc_copy_cost_ns[count]);
+                    if (val->err_check_set(TEST_CHECKPOINT_NUM(203), status))
+                    {
+                        psa->reply(msg.handle, -3);
+                        return status;
+                    }
+                    psa->reply(msg.handle, PSA_SUCCESS);
+                    count += nvecs;
+                }
+
+                ipc_copy_sort(ipc_copy_cost_ns, count);
+                ipc_copy_p50_ns[row] = ipc_copy_cost_ns[count / 2];
+                ipc_copy_min_ns[row] = ipc_copy_cost_ns[0];
+            }
+        }
+    }
+
+#if STATELESS_ROT != 1
+    status = val->process_disconnect_request(SERVER_UNSPECIFIED_VERSION_SIGNAL, &msg);
+    if (val->err_check_set(TEST_CHECKPOINT_NUM(204), status))
+    {
+        return status;
+    }
+    psa->reply(msg.handle, PSA_SUCCESS);
+#endif
+
+    /* Printed once the client is done, the prints are calls to the driver partition */
+    ipc_copy_report();
+
+    return status;
+}
@@ -0,0 +1,46 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _TEST_I093_DATA_H_
+#define _TEST_I093_DATA_H_
+
+/* Interrupts timed per run, at most 256, can be tuned by the platform in pal_config.h */
+#ifndef ARCH_TEST_IRQ_BENCH_ITERATIONS
+#define ARCH_TEST_IRQ_BENCH_ITERATIONS   64
+#endif
+
+/* Non-secure threads calling the server partition during the loaded run */
+#ifndef ARCH_TEST_IRQ_BENCH_LOAD_THREADS
+#define ARCH_TEST_IRQ_BENCH_LOAD_THREADS 2
+#endif
+
+/* Load calls needed per timed interrupt for the loaded run to count, below it the test fails */
+#ifndef ARCH_TEST_IRQ_BENCH_MIN_LOAD_CALLS
+#define ARCH_TEST_IRQ_BENCH_MIN_LOAD_CALLS 1
+#endif
+
+/* psa_call() types of the load service */
+#define IRQ_LOAD_CALL                   0
+#define IRQ_LOAD_STOP                   1
+
+/* Invec size of a load call, read by the service */
+#define IRQ_LOAD_PAYLOAD_SIZE           64
+
+/* Power of two latency buckets of the histogram, the last one holds the rest */
+#define IRQ_BENCH_HIST_BUCKETS          24
+
+#endif /* _TEST_I093_DATA_H_ */
@@ -0,0 +1,346 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifdef NONSECURE_TEST_BUILD
+#include "val_interfaces.h"
+#include "val_target.h"
+#else
+#include "val_client_defs.h"
+#include "val_service_defs.h"
+#endif
+
+#include "test_i093.h"
+#include "test_data.h"
+
+#ifdef NONSECURE_TEST_BUILD
+
+const client_test_t test_i093_client_tests_list[] = {
+    NULL,
+    client_test_irq_latency,
+    NULL,
+};
+
+/* Thread 0 times the interrupts once every load thread has made its first call
+ * (or failed), the other threads load the server partition until stop is set
+ */
+typedef struct {
+    volatile uint32_t stop;
+    uint32_t          started;
+    int32_t           status;
+    uint32_t          calls[ARCH_TEST_IRQ_BENCH_LOAD_THREADS + 1];
+    int32_t           load_status[ARCH_TEST_IRQ_BENCH_LOAD_THREADS + 1];
+} irq_bench_t;
+
+static irq_bench_t irq_bench;
+static uint32_t    irq_delivery_ns[ARCH_TEST_IRQ_BENCH_ITERATIONS];
+static uint32_t    irq_eoi_ns[ARCH_TEST_IRQ_BENCH_ITERATIONS];
+static uint32_t    irq_samples;
+
+static int32_t irq_bench_to_print(uint32_t value)
+{
+    return (value > INT32_MAX) ? INT32_MAX : (int32_t)value;
+}
+
+/* Shell sort, the samples are only ordered to read the percentiles */
+static void irq_bench_sort(uint32_t *data, uint32_t count)
+{
+    uint32_t gap, i, j, value;
+
+    for (gap = count / 2; gap > 0; gap /= 2)
+    {
+        for (i = gap; i < count; i++)
+        {
+            value = data[i];
+            for (j = i; (j >= gap) && (data[j - gap] > value); j -= gap)
+                data[j] = data[j - gap];
+            data[j] = value;
+        }
+    }
+}
+
+static uint32_t irq_bench_percentile(const uint32_t *sorted, uint32_t count, uint32_t pct)
+{
+    return sorted[((count - 1) * pct) / 100];
+}
+
+/**
+    @brief    - Requests ARCH_TEST_IRQ_BENCH_ITERATIONS timed interrupts from the
+                driver partition and stores the returned samples
+    @return   - val_status_t
+**/
+static int32_t irq_bench_sample(void)
+{
+    psa_handle_t         handle;
+    driver_test_fn_id_t  driver_test_fn_id = TEST_IRQ_LATENCY;
+    uint32_t             iterations = ARCH_TEST_IRQ_BENCH_ITERATIONS;
+    psa_invec            invec[2] = { {&driver_test_fn_id, sizeof(driver_test_fn_id)},
+                                      {&iterations, sizeof(iterations)} };
+    psa_outvec           outvec[2] = { {irq_delivery_ns, sizeof(irq_delivery_ns)},
+                                       {irq_eoi_ns, sizeof(irq_eoi_ns)} };
+    psa_status_t         status;
+
+#if STATELESS_ROT == 1
+    handle = DRIVER_TEST_HANDLE;
+#else
+    handle = psa->connect(DRIVER_TEST_SID, DRIVER_TEST_VERSION);
+    if (!PSA_HANDLE_IS_VALID(handle))
+        return VAL_STATUS_CONNECTION_FAILED;
+#endif
+
+    status = psa->call(handle, PSA_IPC_CALL, invec, 2, outvec, 2);
+
+#if STATELESS_ROT != 1
+    psa->close(handle);
+#endif
+
+    if ((status != PSA_SUCCESS) || (outvec[0].len != outvec[1].len) || (outvec[0].len == 0))
+        return VAL_STATUS_CALL_FAILED;
+
+    irq_samples = (uint32_t)(outvec[0].len / sizeof(uint32_t));
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Calls the load service of the server partition until thread 0 is done
+    @param    - idx : Thread index, from 1
+**/
+static void irq_bench_load(uint32_t idx)
+{
+    uint8_t       payload[IRQ_LOAD_PAYLOAD_SIZE];
+    psa_invec     invec[1] = { {payload, sizeof(payload)} };
+    psa_handle_t  handle;
+
+    memset(payload, (int)idx, sizeof(payload));
+
+#if STATELESS_ROT == 1
+    handle = SERVER_UNSPECIFIED_VERSION_HANDLE;
+#else
+    handle = psa->connect(SERVER_UNSPECIFIED_VERSION_SID, SERVER_UNSPECIFIED_VERSION_VERSION);
+    if (!PSA_HANDLE_IS_VALID(handle))
+    {
+        irq_bench.load_status[idx] = VAL_STATUS_CONNECTION_FAILED;
+        __atomic_fetch_add(&irq_bench.started, 1, __ATOMIC_RELEASE);
+        return;
+    }
+#endif
+
+    while (!irq_bench.stop)
+    {
+        if (psa->call(handle, IRQ_LOAD_CALL, invec, 1, NULL, 0) != PSA_SUCCESS)
+        {
+            irq_bench.load_status[idx] = VAL_STATUS_CALL_FAILED;
+            break;
+        }
+        if (irq_bench.calls[idx]++ == 0)
+            __atomic_fetch_add(&irq_bench.started, 1, __ATOMIC_RELEASE);
+    }
+
+    /* A thread failing its first call still has to release thread 0 */
+    if (irq_bench.calls[idx] == 0)
+        __atomic_fetch_add(&irq_bench.started, 1, __ATOMIC_RELEASE);
+
+#if STATELESS_ROT != 1
+    psa->close(handle);
+#endif
+}
+
+static void irq_bench_thread(uint32_t thread_idx, void *arg __UNUSED)
+{
+    uint32_t t;
+
+    if (thread_idx == 0)
+    {
+        /* Start barrier, the interrupts are only timed once the load is running */
+        while (__atomic_load_n(&irq_bench.started, __ATOMIC_ACQUIRE) <
+               ARCH_TEST_IRQ_BENCH_LOAD_THREADS)
+            ;
+
+        irq_bench.status = VAL_STATUS_SUCCESS;
+        for (t = 1; t <= ARCH_TEST_IRQ_BENCH_LOAD_THREADS; t++)
+        {
+            if (VAL_ERROR(irq_bench.load_status[t]))
+                break;
+        }
+        if (t > ARCH_TEST_IRQ_BENCH_LOAD_THREADS)
+            irq_bench.status = irq_bench_sample();
+        irq_bench.stop = 1;
+    }
+    else
+    {
+        irq_bench_load(thread_idx);
+    }
+}
+
+/**
+    @brief    - Tells the load service of the server partition to return
+    @return   - val_status_t
+**/
+static int32_t irq_bench_stop_load(void)
+{
+    psa_handle_t  handle;
+    psa_status_t  status;
+
+#if STATELESS_ROT == 1
+    handle = SERVER_UNSPECIFIED_VERSION_HANDLE;
+#else
+    handle = psa->connect(SERVER_UNSPECIFIED_VERSION_SID, SERVER_UNSPECIFIED_VERSION_VERSION);
+    if (!PSA_HANDLE_IS_VALID(handle))
+        return VAL_STATUS_CONNECTION_FAILED;
+#endif
+
+    status = psa->call(handle, IRQ_LOAD_STOP, NULL, 0, NULL, 0);
+
+#if STATELESS_ROT != 1
+    psa->close(handle);
+#endif
+    return (status == PSA_SUCCESS) ? VAL_STATUS_SUCCESS : VAL_STATUS_CALL_FAILED;
+}
+
+/**
+    @brief    - Prints the latency distribution of the last run, the percentiles
+                then a histogram of the delivery latency in power of two buckets
+    @param    - run          : Name of the run
+                load_threads : Number of load threads of the run
+                load_calls   : Calls made by the load threads
+**/
+static void irq_bench_report(const char *run, uint32_t load_threads, uint32_t load_calls)
+{
+    uint32_t hist[IRQ_BENCH_HIST_BUCKETS] = {0};
+    uint32_t i, bucket, value;
+
+    irq_bench_sort(irq_delivery_ns, irq_samples);
+    irq_bench_sort(irq_eoi_ns, irq_samples);
+
+    val->print(PRINT_TEST, "[Series] ", 0);
+    val->print(PRINT_TEST, run, 0);
+    val->print(PRINT_TEST, ",%d,", (int32_t)load_threads);
+    val->print(PRINT_TEST, "%d,", (int32_t)irq_samples);
+    val->print(PRINT_TEST, "%d,", irq_bench_to_print(load_calls));
+    val->print(PRINT_TEST, "%d,", irq_bench_to_print(irq_delivery_ns[0]));
+    val->print(PRINT_TEST, "%d,",
+               irq_bench_to_print(irq_bench_percentile(irq_delivery_ns, irq_samples, 50)));
+    val->print(PRINT_TEST, "%d,",
+               irq_bench_to_print(irq_bench_percentile(irq_delivery_ns, irq_samples, 90)));
+    val->print(PRINT_TEST, "%d,",
+               irq_bench_to_print(irq_bench_percentile(irq_delivery_ns, irq_samples, 99)));
+    val->print(PRINT_TEST, "%d,", irq_bench_to_print(irq_delivery_ns[irq_samples - 1]));
+    val->print(PRINT_TEST, "%d,",
+               irq_bench_to_print(irq_bench_percentile(irq_eoi_ns, irq_samples, 50)));
+    val->print(PRINT_TEST, "%d,",
+               irq_bench_to_print(irq_bench_percentile(irq_eoi_ns, irq_samples, 99)));
+    val->print(PRINT_TEST, "%d\n", irq_bench_to_print(irq_eoi_ns[irq_samples - 1]));
+
+    for (i = 0; i < irq_samples; i++)
+    {
+        value = irq_delivery_ns[i];
+        for (bucket = 0; (bucket < IRQ_BENCH_HIST_BUCKETS - 1) && (value != 0); bucket++)
+            value >>= 1;
+        hist[bucket]++;
+    }
+
+    for (bucket = 0; bucket < IRQ_BENCH_HIST_BUCKETS; bucket++)
+    {
+        if (hist[bucket] == 0)
+            continue;
+        val->print(PRINT_TEST, "[Series] hist,", 0);
+        val->print(PRINT_TEST, run, 0);
+        val->print(PRINT_TEST, ",%d,", irq_bench_to_print(1u << bucket));
+        val->print(PRINT_TEST, "%d\n", (int32_t)hist[bucket]);
+    }
+}
+
+int32_t client_test_irq_latency(caller_security_t caller __UNUSED)
+{
+    int32_t   status, stop_status;
+    uint64_t  timestamp;
+    uint32_t  t, load_calls = 0;
+
+    val->print(PRINT_TEST, "[Check 1] Test irq delivery latency under psa_call load\n", 0);
+
+    if (val->get_timestamp(&timestamp) != VAL_STATUS_SUCCESS)
+        val->print(PRINT_TEST, "[Info] No platform timestamp, latency is reported as 0\n", 0);
+    val->print(PRINT_TEST, "[Series] run,load_threads,samples,load_calls,delivery_min_ns,"
+               "delivery_p50_ns,delivery_p90_ns,delivery_p99_ns,delivery_max_ns,"
+               "eoi_p50_ns,eoi_p99_ns,eoi_max_ns\n", 0);
+    val->print(PRINT_TEST, "[Series] hist,run,delivery_lt_ns,samples\n", 0);
+
+    /* Idle run, nothing else is calling the secure partitions */
+    status = irq_bench_sample();
+    if (VAL_ERROR(status))
+    {
+        val->print(PRINT_ERROR, "\tIdle irq latency request failed\n", 0);
+        goto exit;
+    }
+    irq_bench_report("idle", 0, 0);
+
+    /* Loaded run, the interrupts are timed while the load threads call the server partition */
+    memset(&irq_bench, 0, sizeof(irq_bench));
+    status = val->run_threads(ARCH_TEST_IRQ_BENCH_LOAD_THREADS + 1, irq_bench_thread, NULL);
+    if (status == VAL_STATUS_UNSUPPORTED)
+    {
+        val->print(PRINT_TEST, "[Info] Platform cannot run threads, no loaded run\n", 0);
+        status = VAL_STATUS_SUCCESS;
+        goto exit;
+    }
+    if (VAL_ERROR(status) || VAL_ERROR(irq_bench.status))
+    {
+        val->print(PRINT_ERROR, "\tLoaded irq latency request failed\n", 0);
+        status = VAL_STATUS_CALL_FAILED;
+        goto exit;
+    }
+
+    for (t = 1; t <= ARCH_TEST_IRQ_BENCH_LOAD_THREADS; t++)
+    {
+        if (VAL_ERROR(irq_bench.load_status[t]))
+        {
+            val->print(PRINT_ERROR, "\tLoad thread %d failed\n", (int32_t)t);
+            status = irq_bench.load_status[t];
+            goto exit;
+        }
+        load_calls += irq_bench.calls[t];
+    }
+    irq_bench_report("loaded", ARCH_TEST_IRQ_BENCH_LOAD_THREADS, load_calls);
+
+    /* The load threads have to keep calling while the interrupts are timed */
+    if (load_calls < irq_samples * ARCH_TEST_IRQ_BENCH_MIN_LOAD_CALLS)
+    {
+        val->print(PRINT_ERROR, "\tLoad of %d calls is negligible for the loaded run\n",
+                   irq_bench_to_print(load_calls));
+        status = VAL_STATUS_ERROR;
+        goto exit;
+    }
+
+exit:
+    stop_status = irq_bench_stop_load();
+    if (VAL_ERROR(stop_status))
+    {
+        val->print(PRINT_ERROR, "\tFailed to stop the load service\n", 0);
+        if (!VAL_ERROR(status))
+            status = stop_status;
+    }
+    return status;
+}
+
+#else
+
+/* The load threads only run on the non-secure side */
+const client_test_t test_i093_client_tests_list[] = {
+    NULL,
+    NULL,
+};
+
+#endif
@@ -0,0 +1,89 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_client_defs.h"
+#include "val_service_defs.h"
+#include "test_data.h"
+
+#define val CONCAT(val, _server_sp)
+#define psa CONCAT(psa, _server_sp)
+extern val_api_t *val;
+extern psa_api_t *psa;
+
+int32_t server_test_irq_latency_load(void);
+
+const server_test_t test_i093_server_tests_list[] = {
+    NULL,
+    server_test_irq_latency_load,
+    NULL,
+};
+
+/**
+    @brief    - Load service of the loaded run. Serves the calls of every load thread,
+                reading their invec, until the client sends IRQ_LOAD_STOP.
+    @return   - val_status_t
+**/
+int32_t server_test_irq_latency_load(void)
+{
+    psa_msg_t       msg = {0};
+    psa_signal_t    signals;
+    uint8_t         payload[IRQ_LOAD_PAYLOAD_SIZE];
+    uint32_t        stopping = 0;
+
+    while (1)
+    {
+        signals = psa->wait(SERVER_UNSPECIFIED_VERSION_SIGNAL, PSA_BLOCK);
+        if ((signals & SERVER_UNSPECIFIED_VERSION_SIGNAL) == 0)
+            continue;
+        if (psa->get(SERVER_UNSPECIFIED_VERSION_SIGNAL, &msg) != PSA_SUCCESS)
+            continue;
+
+        switch (msg.type)
+        {
+            case PSA_IPC_CONNECT:
+                psa->reply(msg.handle, PSA_SUCCESS);
+                break;
+            case PSA_IPC_DISCONNECT:
+                psa->reply(msg.handle, PSA_SUCCESS);
+                /* The stop connection is the last one to close */
+                if (stopping)
+                    return VAL_STATUS_SUCCESS;
+                break;
+            case IRQ_LOAD_CALL:
+                if (psa->read(msg.handle, 0, payload, sizeof(payload)) != sizeof(payload))
+                {
+                    val->err_check_set(TEST_CHECKPOINT_NUM(201), VAL_STATUS_READ_FAILED);
+                    psa->reply(msg.handle, -2);
+                    return VAL_STATUS_READ_FAILED;
+                }
+                psa->reply(msg.handle, PSA_SUCCESS);
+                break;
+            case IRQ_LOAD_STOP:
+                psa->reply(msg.handle, PSA_SUCCESS);
+#if STATELESS_ROT == 1
+                return VAL_STATUS_SUCCESS;
+#else
+                stopping = 1;
+                break;
+#endif
+            default:
+                val->err_check_set(TEST_CHECKPOINT_NUM(202), VAL_STATUS_ERROR);
+                psa->reply(msg.handle, -2);
+                return VAL_STATUS_ERROR;
+        }
+    }
+}
@@ -0,0 +1,65 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _TEST_I094_DATA_H_
+#define _TEST_I094_DATA_H_
+
+/* Calls made by every non-secure thread of the fairness check, can be tuned by the
+ * platform in pal_config.h
+ */
+#ifndef ARCH_TEST_SIGNAL_FAIRNESS_CALLS
+#define ARCH_TEST_SIGNAL_FAIRNESS_CALLS  128
+#endif
+
+/* Doorbell rounds per burst size */
+#ifndef ARCH_TEST_DOORBELL_BENCH_ROUNDS
+#define ARCH_TEST_DOORBELL_BENCH_ROUNDS  64
+#endif
+
+/* psa_call() types of the server */
+#define SIGNAL_BENCH_LOAD               0
+#define SIGNAL_BENCH_PUMP               1
+#define SIGNAL_BENCH_POLICY             2
+#define SIGNAL_BENCH_STATS              3
+#define SIGNAL_BENCH_STOP               4
+
+/* Order in which the server serves the signals returned together by psa_wait() */
+#define SIGNAL_POLICY_ROUND_ROBIN       0
+#define SIGNAL_POLICY_LOWEST_FIRST      1
+#define SIGNAL_NUM_POLICIES             2
+
+/* One non-secure thread per service, each service has its own signal */
+#define SIGNAL_FAIRNESS_SERVICES        3
+
+/* psa_notify() calls per SIGNAL_BENCH_PUMP request of the throughput check */
+#define DOORBELL_BURSTS                 {1, 8, 64}
+#define DOORBELL_NUM_BURSTS             3
+
+typedef struct {
+    uint32_t served[SIGNAL_FAIRNESS_SERVICES];
+    uint32_t max_skipped[SIGNAL_FAIRNESS_SERVICES];
+    uint32_t waits;
+    uint32_t multi_signal_waits;
+} signal_fairness_stats_t;
+
+typedef struct {
+    uint32_t notified;
+    uint32_t reserved;
+    uint64_t notify_ns;
+} doorbell_stats_t;
+
+#endif /* _TEST_I094_DATA_H_ */
@@ -0,0 +1,502 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifdef NONSECURE_TEST_BUILD
+#include "val_interfaces.h"
+#include "val_target.h"
+#else
+#include "val_client_defs.h"
+#include "val_service_defs.h"
+#endif
+
+#include "test_i094.h"
+#include "test_data.h"
+
+#ifdef NONSECURE_TEST_BUILD
+const client_test_t test_i094_client_tests_list[] = {
+    NULL,
+    client_test_signal_fairness,
+    NULL,
+};
+#else
+const client_test_t test_i094_client_tests_list[] = {
+    NULL,
+    client_test_signal_fairness,
+    client_test_doorbell_throughput,
+    client_test_doorbell_wakeup,
+    NULL,
+};
+#endif
+
+static int32_t signal_bench_to_print(uint64_t value)
+{
+    return (value > INT32_MAX) ? INT32_MAX : (int32_t)value;
+}
+
+static uint64_t signal_bench_timestamp(void)
+{
+    uint64_t timestamp = 0;
+
+    if (val->get_timestamp(&timestamp) != VAL_STATUS_SUCCESS)
+        timestamp = 0;
+    return timestamp;
+}
+
+/* Shell sort, the samples are only ordered to read the percentiles */
+static void signal_bench_sort(uint32_t *data, uint32_t count)
+{
+    uint32_t gap, i, j, value;
+
+    for (gap = count / 2; gap > 0; gap /= 2)
+    {
+        for (i = gap; i < count; i++)
+        {
+            value = data[i];
+            for (j = i; (j >= gap) && (data[j - gap] > value); j -= gap)
+                data[j] = data[j - gap];
+            data[j] = value;
+        }
+    }
+}
+
+static uint32_t signal_bench_percentile(const uint32_t *sorted, uint32_t count, uint32_t pct)
+{
+    return sorted[((count - 1) * pct) / 100];
+}
+
+static uint32_t signal_bench_elapsed(uint64_t start, uint64_t end)
+{
+    uint64_t elapsed = (end > start) ? end - start : 0;
+
+    return (elapsed > UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsed;
+}
+
+/**
+    @brief    - Opens the control connection of a check, to SERVER_UNSPECIFIED_VERSION
+    @param    - handle : Returns the handle
+    @return   - val_status_t
+**/
+static int32_t signal_bench_connect(psa_handle_t *handle)
+{
+#if STATELESS_ROT == 1
+    *handle = SERVER_UNSPECIFIED_VERSION_HANDLE;
+#else
+    *handle = psa->connect(SERVER_UNSPECIFIED_VERSION_SID, SERVER_UNSPECIFIED_VERSION_VERSION);
+    if (!PSA_HANDLE_IS_VALID(*handle))
+    {
+        val->print(PRINT_ERROR, "\tConnection failed\n", 0);
+        return VAL_STATUS_CONNECTION_FAILED;
+    }
+#endif
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Tells the server function of the check to return, then closes the
+                control connection
+    @param    - handle : Control connection
+    @return   - val_status_t
+**/
+static int32_t signal_bench_stop(psa_handle_t handle)
+{
+    psa_status_t status;
+
+    status = psa->call(handle, SIGNAL_BENCH_STOP, NULL, 0, NULL, 0);
+#if STATELESS_ROT != 1
+    psa->close(handle);
+#endif
+    if (status != PSA_SUCCESS)
+    {
+        val->print(PRINT_ERROR, "\tFailed to stop the server\n", 0);
+        return VAL_STATUS_CALL_FAILED;
+    }
+    return VAL_STATUS_SUCCESS;
+}
+
+#ifdef NONSECURE_TEST_BUILD
+
+typedef struct {
+    const char   *name;
+#if STATELESS_ROT == 1
+    psa_handle_t  handle;
+#else
+    uint32_t      sid;
+    uint32_t      version;
+#endif
+} signal_fairness_service_t;
+
+/* Same order as the signals of the server */
+static const signal_fairness_service_t signal_fairness_services[SIGNAL_FAIRNESS_SERVICES] = {
+#if STATELESS_ROT == 1
+    {"strict", SERVER_STRICT_VERSION_HANDLE},
+    {"unspecified", SERVER_UNSPECIFIED_VERSION_HANDLE},
+    {"relax", SERVER_RELAX_VERSION_HANDLE},
+#else
+    {"strict", SERVER_STRICT_VERSION_SID, SERVER_STRICT_VERSION_VERSION},
+    {"unspecified", SERVER_UNSPECIFIED_VERSION_SID, SERVER_UNSPECIFIED_VERSION_VERSION},
+    {"relax", SERVER_RELAX_VERSION_SID, SERVER_RELAX_VERSION_VERSION},
+#endif
+};
+
+static const char *const signal_policy_names[SIGNAL_NUM_POLICIES] = {"round_robin",
+                                                                     "lowest_first"};
+
+static uint32_t signal_fairness_ns[SIGNAL_FAIRNESS_SERVICES][ARCH_TEST_SIGNAL_FAIRNESS_CALLS];
+static int32_t  signal_fairness_status[SIGNAL_FAIRNESS_SERVICES];
+
+/**
+    @brief    - Thread t makes ARCH_TEST_SIGNAL_FAIRNESS_CALLS calls to service t and
+                times each of them
+    @param    - thread_idx : Thread index, selects the service
+**/
+static void signal_fairness_thread(uint32_t thread_idx, void *arg __UNUSED)
+{
+    const signal_fairness_service_t *service = &signal_fairness_services[thread_idx];
+    psa_handle_t                     handle;
+    uint64_t                         start;
+    uint32_t                         i;
+
+#if STATELESS_ROT == 1
+    handle = service->handle;
+#else
+    handle = psa->connect(service->sid, service->version);
+    if (!PSA_HANDLE_IS_VALID(handle))
+    {
+        signal_fairness_status[thread_idx] = VAL_STATUS_CONNECTION_FAILED;
+        return;
+    }
+#endif
+
+    for (i = 0; i < ARCH_TEST_SIGNAL_FAIRNESS_CALLS; i++)
+    {
+        start = signal_bench_timestamp();
+        if (psa->call(handle, SIGNAL_BENCH_LOAD, NULL, 0, NULL, 0) != PSA_SUCCESS)
+        {
+            signal_fairness_status[thread_idx] = VAL_STATUS_CALL_FAILED;
+            break;
+        }
+        signal_fairness_ns[thread_idx][i] = signal_bench_elapsed(start,
+                                                                 signal_bench_timestamp());
+    }
+
+#if STATELESS_ROT != 1
+    psa->close(handle);
+#endif
+}
+
+/**
+    @brief    - Runs one fairness pass, all services called at once, with the given
+                server policy and prints a [Series] line per service
+    @param    - handle : Control connection
+                policy : Server policy of the pass
+    @return   - val_status_t
+**/
+static int32_t signal_fairness_pass(psa_handle_t handle, uint32_t policy)
+{
+    signal_fairness_stats_t stats;
+    psa_invec               invec[1] = { {&policy, sizeof(policy)} };
+    psa_outvec              outvec[1] = { {&stats, sizeof(stats)} };
+    uint32_t                t;
+    uint32_t               *samples;
+    int32_t                 status;
+
+    if (psa->call(handle, SIGNAL_BENCH_POLICY, invec, 1, NULL, 0) != PSA_SUCCESS)
+        return VAL_STATUS_CALL_FAILED;
+
+    memset(signal_fairness_status, 0, sizeof(signal_fairness_status));
+    status = val->run_threads(SIGNAL_FAIRNESS_SERVICES, signal_fairness_thread, NULL);
+    if (status != VAL_STATUS_SUCCESS)
+        return status;
+
+    for (t = 0; t < SIGNAL_FAIRNESS_SERVICES; t++)
+    {
+        if (VAL_ERROR(signal_fairness_status[t]))
+        {
+            val->print(PRINT_ERROR, "\tCaller thread %d failed\n", (int32_t)t);
+            return signal_fairness_status[t];
+        }
+    }
+
+    if ((psa->call(handle, SIGNAL_BENCH_STATS, NULL, 0, outvec, 1) != PSA_SUCCESS) ||
+        (outvec[0].len != sizeof(stats)))
+        return VAL_STATUS_CALL_FAILED;
+
+    for (t = 0; t < SIGNAL_FAIRNESS_SERVICES; t++)
+    {
+        samples = signal_fairness_ns[t];
+        signal_bench_sort(samples, ARCH_TEST_SIGNAL_FAIRNESS_CALLS);
+
+        val->print(PRINT_TEST, "[Series] ", 0);
+        val->print(PRINT_TEST, (char *)signal_policy_names[policy], 0);
+        val->print(PRINT_TEST, ",", 0);
+        val->print(PRINT_TEST, (char *)signal_fairness_services[t].name, 0);
+        val->print(PRINT_TEST, ",%d,", (int32_t)stats.served[t]);
+        val->print(PRINT_TEST, "%d,", signal_bench_to_print(
+                   signal_bench_percentile(samples, ARCH_TEST_SIGNAL_FAIRNESS_CALLS, 50)));
+        val->print(PRINT_TEST, "%d,", signal_bench_to_print(
+                   signal_bench_percentile(samples, ARCH_TEST_SIGNAL_FAIRNESS_CALLS, 99)));
+        val->print(PRINT_TEST, "%d,",
+                   signal_bench_to_print(samples[ARCH_TEST_SIGNAL_FAIRNESS_CALLS - 1]));
+        val->print(PRINT_TEST, "%d\n", (int32_t)stats.max_skipped[t]);
+    }
+    val->print(PRINT_TEST, "[Info] psa_wait() returns with more than one signal: %d",
+               (int32_t)stats.multi_signal_waits);
+    val->print(PRINT_TEST, " of %d\n", (int32_t)stats.waits);
+
+    for (t = 0; t < SIGNAL_FAIRNESS_SERVICES; t++)
+    {
+        if (stats.served[t] != ARCH_TEST_SIGNAL_FAIRNESS_CALLS)
+        {
+            val->print(PRINT_ERROR, "\tCalls lost on service %d\n", (int32_t)t);
+            return VAL_STATUS_ERROR;
+        }
+
+        /* A round robin server serves an asserted signal within one round */
+        if ((policy == SIGNAL_POLICY_ROUND_ROBIN) &&
+            (stats.max_skipped[t] >= SIGNAL_FAIRNESS_SERVICES))
+        {
+            val->print(PRINT_ERROR, "\tSignal of service %d starved\n", (int32_t)t);
+            return VAL_STATUS_ERROR;
+        }
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+#endif
+
+int32_t client_test_signal_fairness(caller_security_t caller __UNUSED)
+{
+    int32_t       status = VAL_STATUS_SUCCESS, stop_status;
+    psa_handle_t  handle;
+#ifdef NONSECURE_TEST_BUILD
+    uint32_t      policy;
+#endif
+
+    val->print(PRINT_TEST, "[Check 1] Test psa_wait fairness across service signals\n", 0);
+
+    status = signal_bench_connect(&handle);
+    if (VAL_ERROR(status))
+        return status;
+
+#ifdef NONSECURE_TEST_BUILD
+    val->print(PRINT_TEST, "[Series] policy,service,calls,p50_ns,p99_ns,max_ns,"
+               "max_skipped_waits\n", 0);
+    for (policy = 0; policy < SIGNAL_NUM_POLICIES; policy++)
+    {
+        status = signal_fairness_pass(handle, policy);
+        if (status == VAL_STATUS_UNSUPPORTED)
+        {
+            val->print(PRINT_TEST, "[Info] Platform cannot run threads, no concurrent "
+                       "callers\n", 0);
+            status = VAL_STATUS_SUCCESS;
+            break;
+        }
+        if (VAL_ERROR(status))
+            break;
+    }
+#else
+    /* A secure partition makes one call at a time, the callers are non-secure threads */
+    val->print(PRINT_TEST, "[Info] Concurrent callers only run from non-secure\n", 0);
+#endif
+
+    stop_status = signal_bench_stop(handle);
+    return VAL_ERROR(status) ? status : stop_status;
+}
+
+#ifndef NONSECURE_TEST_BUILD
+
+/**
+    @brief    - Clears the doorbell if it is pending, psa_clear() is a PROGRAMMER ERROR
+                otherwise
+    @return   - 1 when the doorbell was pending, 0 otherwise
+**/
+static uint32_t doorbell_clear(void)
+{
+    if ((psa->wait(PSA_DOORBELL, PSA_POLL) & PSA_DOORBELL) == 0)
+        return 0;
+
+    psa->clear();
+    return 1;
+}
+
+/**
+    @brief    - Asks the server for a burst of doorbells
+    @param    - handle   : Control connection
+                burst    : Number of psa_notify() calls
+                notified : Returns the doorbells rung before the burst
+    @return   - val_status_t
+**/
+static int32_t doorbell_pump(psa_handle_t handle, uint32_t burst, uint32_t *notified)
+{
+    psa_invec   invec[1] = { {&burst, sizeof(burst)} };
+    psa_outvec  outvec[1] = { {notified, sizeof(*notified)} };
+
+    if (psa->call(handle, SIGNAL_BENCH_PUMP, invec, 1, outvec, 1) != PSA_SUCCESS)
+    {
+        val->print(PRINT_ERROR, "\tDoorbell request failed\n", 0);
+        return VAL_STATUS_CALL_FAILED;
+    }
+    return VAL_STATUS_SUCCESS;
+}
+
+static int32_t doorbell_stats(psa_handle_t handle, doorbell_stats_t *stats)
+{
+    psa_outvec  outvec[1] = { {stats, sizeof(*stats)} };
+
+    if (psa->call(handle, SIGNAL_BENCH_STATS, NULL, 0, outvec, 1) != PSA_SUCCESS)
+    {
+        val->print(PRINT_ERROR, "\tDoorbell stats request failed\n", 0);
+        return VAL_STATUS_CALL_FAILED;
+    }
+    return VAL_STATUS_SUCCESS;
+}
+
+int32_t client_test_doorbell_throughput(caller_security_t caller __UNUSED)
+{
+    static const uint32_t bursts[DOORBELL_NUM_BURSTS] = DOORBELL_BURSTS;
+    doorbell_stats_t      stats, last = {0};
+    psa_handle_t          handle;
+    uint32_t              b, round, before, wakeups, lost;
+    uint64_t              notified, notify_ns;
+    int32_t               status, stop_status;
+
+    val->print(PRINT_TEST, "[Check 2] Test psa_notify doorbell throughput and lost wakeups\n", 0);
+
+    status = signal_bench_connect(&handle);
+    if (VAL_ERROR(status))
+        return status;
+
+    val->print(PRINT_TEST, "[Series] burst,rounds,notifies,wakeups,lost_wakeups,"
+               "notifies_per_sec\n", 0);
+    for (b = 0; b < DOORBELL_NUM_BURSTS; b++)
+    {
+        wakeups = 0;
+        lost = 0;
+        for (round = 0; round < ARCH_TEST_DOORBELL_BENCH_ROUNDS; round++)
+        {
+            doorbell_clear();
+            status = doorbell_pump(handle, bursts[b], &before);
+            if (VAL_ERROR(status))
+                goto exit;
+
+            /* Served once the burst is over */
+            status = doorbell_stats(handle, &stats);
+            if (VAL_ERROR(status))
+                goto exit;
+
+            /* Every doorbell rung after the clear must still be pending */
+            if (doorbell_clear())
+                wakeups++;
+            else if (stats.notified > before)
+                lost++;
+        }
+
+        notified = stats.notified - last.notified;
+        notify_ns = stats.notify_ns - last.notify_ns;
+        last = stats;
+
+        val->print(PRINT_TEST, "[Series] %d,", (int32_t)bursts[b]);
+        val->print(PRINT_TEST, "%d,", ARCH_TEST_DOORBELL_BENCH_ROUNDS);
+        val->print(PRINT_TEST, "%d,", signal_bench_to_print(notified));
+        val->print(PRINT_TEST, "%d,", (int32_t)wakeups);
+        val->print(PRINT_TEST, "%d,", (int32_t)lost);
+        val->print(PRINT_TEST, "%d\n",
+                   notify_ns ? signal_bench_to_print((notified * 1000000000ull) / notify_ns) : 0);
+
+        if (lost)
+        {
+            val->print(PRINT_ERROR, "\tDoorbell lost for burst of %d\n", (int32_t)bursts[b]);
+            status = VAL_STATUS_ERROR;
+            goto exit;
+        }
+    }
+
+exit:
+    doorbell_clear();
+    stop_status = signal_bench_stop(handle);
+    return VAL_ERROR(status) ? status : stop_status;
+}
+
+int32_t client_test_doorbell_wakeup(caller_security_t caller __UNUSED)
+{
+    static uint32_t  call_ns[ARCH_TEST_DOORBELL_BENCH_ROUNDS];
+    static uint32_t  wakeup_ns[ARCH_TEST_DOORBELL_BENCH_ROUNDS];
+    psa_handle_t     handle;
+    psa_signal_t     signals;
+    uint32_t         round, before;
+    uint64_t         start, total_ns = 0;
+    int32_t          status, stop_status;
+
+    val->print(PRINT_TEST, "[Check 3] Test psa_wait doorbell wakeup rate\n", 0);
+
+    status = signal_bench_connect(&handle);
+    if (VAL_ERROR(status))
+        return status;
+
+    doorbell_clear();
+    for (round = 0; round < ARCH_TEST_DOORBELL_BENCH_ROUNDS; round++)
+    {
+        /* Request without doorbell, the cost of the call alone */
+        start = signal_bench_timestamp();
+        status = doorbell_pump(handle, 0, &before);
+        if (VAL_ERROR(status))
+            goto exit;
+        call_ns[round] = signal_bench_elapsed(start, signal_bench_timestamp());
+
+        /* A lost doorbell blocks here until the watchdog expires */
+        start = signal_bench_timestamp();
+        status = doorbell_pump(handle, 1, &before);
+        if (VAL_ERROR(status))
+            goto exit;
+        signals = psa->wait(PSA_DOORBELL, PSA_BLOCK);
+        wakeup_ns[round] = signal_bench_elapsed(start, signal_bench_timestamp());
+        total_ns += wakeup_ns[round];
+
+        if ((signals & PSA_DOORBELL) == 0)
+        {
+            val->print(PRINT_ERROR, "\tpsa_wait returned without doorbell, signals=0x%x\n",
+                       (int32_t)signals);
+            status = VAL_STATUS_ERROR;
+            goto exit;
+        }
+        psa->clear();
+    }
+
+    signal_bench_sort(call_ns, ARCH_TEST_DOORBELL_BENCH_ROUNDS);
+    signal_bench_sort(wakeup_ns, ARCH_TEST_DOORBELL_BENCH_ROUNDS);
+    val->print(PRINT_TEST, "[Series] rounds,call_p50_ns,wakeup_p50_ns,wakeup_p99_ns,"
+               "wakeup_max_ns,wakeups_per_sec\n", 0);
+    val->print(PRINT_TEST, "[Series] %d,", ARCH_TEST_DOORBELL_BENCH_ROUNDS);
+    val->print(PRINT_TEST, "%d,", signal_bench_to_print(
+               signal_bench_percentile(call_ns, ARCH_TEST_DOORBELL_BENCH_ROUNDS, 50)));
+    val->print(PRINT_TEST, "%d,", signal_bench_to_print(
+               signal_bench_percentile(wakeup_ns, ARCH_TEST_DOORBELL_BENCH_ROUNDS, 50)));
+    val->print(PRINT_TEST, "%d,", signal_bench_to_print(
+               signal_bench_percentile(wakeup_ns, ARCH_TEST_DOORBELL_BENCH_ROUNDS, 99)));
+    val->print(PRINT_TEST, "%d,",
+               signal_bench_to_print(wakeup_ns[ARCH_TEST_DOORBELL_BENCH_ROUNDS - 1]));
+    val->print(PRINT_TEST, "%d\n", total_ns ? signal_bench_to_print(
+               (ARCH_TEST_DOORBELL_BENCH_ROUNDS * 1000000000ull) / total_ns) : 0);
+
+exit:
+    doorbell_clear();
+    stop_status = signal_bench_stop(handle);
+    return VAL_ERROR(status) ? status : stop_status;
+}
+
+#endif
@@ -0,0 +1,241 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_client_defs.h"
+#include "val_service_defs.h"
+#include "test_data.h"
+
+#define val CONCAT(val, _server_sp)
+#define psa CONCAT(psa, _server_sp)
+extern val_api_t *val;
+extern psa_api_t *psa;
+
+int32_t server_test_signal_fairness(void);
+int32_t server_test_doorbell_pump(void);
+
+const server_test_t test_i094_server_tests_list[] = {
+    NULL,
+    server_test_signal_fairness,
+    server_test_doorbell_pump,
+    server_test_doorbell_pump,
+    NULL,
+};
+
+/* Signals of the fairness check, in the lowest bit first order */
+static const psa_signal_t signal_fairness_signals[SIGNAL_FAIRNESS_SERVICES] = {
+    SERVER_STRICT_VERSION_SIGNAL,
+    SERVER_UNSPECIFIED_VERSION_SIGNAL,
+    SERVER_RELAX_VERSION_SIGNAL,
+};
+
+static uint64_t signal_bench_timestamp(void)
+{
+    uint64_t timestamp = 0;
+
+    if (val->get_timestamp(&timestamp) != VAL_STATUS_SUCCESS)
+        timestamp = 0;
+    return timestamp;
+}
+
+/**
+    @brief    - Picks the signal served next among the ones returned by psa_wait()
+    @param    - signals : Signals returned by psa_wait()
+                policy  : SIGNAL_POLICY_ROUND_ROBIN or SIGNAL_POLICY_LOWEST_FIRST
+                next    : Round robin position, updated
+    @return   - Index of the served signal in signal_fairness_signals
+**/
+static uint32_t signal_fairness_pick(psa_signal_t signals, uint32_t policy, uint32_t *next)
+{
+    uint32_t i, idx;
+
+    for (i = 0; i < SIGNAL_FAIRNESS_SERVICES; i++)
+    {
+        idx = (policy == SIGNAL_POLICY_ROUND_ROBIN) ? (*next + i) % SIGNAL_FAIRNESS_SERVICES : i;
+        if (signals & signal_fairness_signals[idx])
+            break;
+    }
+
+    if (policy == SIGNAL_POLICY_ROUND_ROBIN)
+        *next = (idx + 1) % SIGNAL_FAIRNESS_SERVICES;
+    return idx;
+}
+
+/**
+    @brief    - Serves the three services of the fairness check from a single psa_wait()
+                mask, one message per psa_wait() return. Counts, per signal, the calls
+                served and the most psa_wait() returns in a row the signal was asserted
+                without being served.
+    @return   - val_status_t
+**/
+int32_t server_test_signal_fairness(void)
+{
+    signal_fairness_stats_t stats = {0};
+    uint32_t                skipped[SIGNAL_FAIRNESS_SERVICES] = {0};
+    psa_signal_t            mask = 0, signals;
+    psa_msg_t               msg = {0};
+    uint32_t                policy = SIGNAL_POLICY_ROUND_ROBIN, next = 0, stopping = 0;
+    uint32_t                i, idx, asserted;
+
+    for (i = 0; i < SIGNAL_FAIRNESS_SERVICES; i++)
+        mask |= signal_fairness_signals[i];
+
+    while (1)
+    {
+        signals = psa->wait(mask, PSA_BLOCK);
+        if ((signals & mask) == 0)
+            continue;
+
+        idx = signal_fairness_pick(signals, policy, &next);
+        asserted = 0;
+        for (i = 0; i < SIGNAL_FAIRNESS_SERVICES; i++)
+        {
+            if ((signals & signal_fairness_signals[i]) == 0)
+                continue;
+            asserted++;
+            if (i == idx)
+            {
+                skipped[i] = 0;
+            }
+            else if (++skipped[i] > stats.max_skipped[i])
+            {
+                stats.max_skipped[i] = skipped[i];
+            }
+        }
+        stats.waits++;
+        if (asserted > 1)
+            stats.multi_signal_waits++;
+
+        if (psa->get(signal_fairness_signals[idx], &msg) != PSA_SUCCESS)
+            continue;
+
+        switch (msg.type)
+        {
+            case PSA_IPC_CONNECT:
+                psa->reply(msg.handle, PSA_SUCCESS);
+                break;
+            case PSA_IPC_DISCONNECT:
+                psa->reply(msg.handle, PSA_SUCCESS);
+                /* The control connection is the last one to close */
+                if (stopping)
+                    return VAL_STATUS_SUCCESS;
+                break;
+            case SIGNAL_BENCH_LOAD:
+                stats.served[idx]++;
+                psa->reply(msg.handle, PSA_SUCCESS);
+                break;
+            case SIGNAL_BENCH_POLICY:
+                if ((msg.in_size[0] != sizeof(policy)) ||
+                    (psa->read(msg.handle, 0, &policy, sizeof(policy)) != sizeof(policy)) ||
+                    (policy >= SIGNAL_NUM_POLICIES))
+                {
+                    val->err_check_set(TEST_CHECKPOINT_NUM(201), VAL_STATUS_READ_FAILED);
+                    psa->reply(msg.handle, -2);
+                    return VAL_STATUS_READ_FAILED;
+                }
+                memset(&stats, 0, sizeof(stats));
+                memset(skipped, 0, sizeof(skipped));
+                next = 0;
+                psa->reply(msg.handle, PSA_SUCCESS);
+                break;
+            case SIGNAL_BENCH_STATS:
+                psa->write(msg.handle, 0, &stats, sizeof(stats));
+                psa->reply(msg.handle, PSA_SUCCESS);
+                break;
+            case SIGNAL_BENCH_STOP:
+                psa->reply(msg.handle, PSA_SUCCESS);
+#if STATELESS_ROT == 1
+                return VAL_STATUS_SUCCESS;
+#else
+                stopping = 1;
+                break;
+#endif
+            default:
+                val->err_check_set(TEST_CHECKPOINT_NUM(202), VAL_STATUS_ERROR);
+                psa->reply(msg.handle, -2);
+                return VAL_STATUS_ERROR;
+        }
+    }
+}
+
+/**
+    @brief    - Doorbell producer. Every SIGNAL_BENCH_PUMP request is replied with the
+                number of doorbells rung so far, then rings the doorbell of the calling
+                partition as many times as requested, back to back.
+    @return   - val_status_t
+**/
+int32_t server_test_doorbell_pump(void)
+{
+    doorbell_stats_t    stats = {0};
+    psa_msg_t           msg = {0};
+    uint32_t            burst, i, stopping = 0;
+    uint64_t            start;
+
+    while (1)
+    {
+        if ((psa->wait(SERVER_UNSPECIFIED_VERSION_SIGNAL, PSA_BLOCK) &
+             SERVER_UNSPECIFIED_VERSION_SIGNAL) == 0)
+            continue;
+        if (psa->get(SERVER_UNSPECIFIED_VERSION_SIGNAL, &msg) != PSA_SUCCESS)
+            continue;
+
+        switch (msg.type)
+        {
+            case PSA_IPC_CONNECT:
+                psa->reply(msg.handle, PSA_SUCCESS);
+                break;
+            case PSA_IPC_DISCONNECT:
+                psa->reply(msg.handle, PSA_SUCCESS);
+                if (stopping)
+                    return VAL_STATUS_SUCCESS;
+                break;
+            case SIGNAL_BENCH_PUMP:
+                /* Doorbells can only be rung for secure partitions */
+                if ((msg.client_id <= 0) || (msg.in_size[0] != sizeof(burst)) ||
+                    (psa->read(msg.handle, 0, &burst, sizeof(burst)) != sizeof(burst)))
+                {
+                    val->err_check_set(TEST_CHECKPOINT_NUM(203), VAL_STATUS_READ_FAILED);
+                    psa->reply(msg.handle, -2);
+                    return VAL_STATUS_READ_FAILED;
+                }
+                psa->write(msg.handle, 0, &stats.notified, sizeof(stats.notified));
+                psa->reply(msg.handle, PSA_SUCCESS);
+
+                start = signal_bench_timestamp();
+                for (i = 0; i < burst; i++)
+                    psa->notify(msg.client_id);
+                stats.notify_ns += signal_bench_timestamp() - start;
+                stats.notified += burst;
+                break;
+            case SIGNAL_BENCH_STATS:
+                psa->write(msg.handle, 0, &stats, sizeof(stats));
+                psa->reply(msg.handle, PSA_SUCCESS);
+                break;
+            case SIGNAL_BENCH_STOP:
+                psa->reply(msg.handle, PSA_SUCCESS);
+#if STATELESS_ROT == 1
+                return VAL_STATUS_SUCCESS;
+#else
+                stopping = 1;
+                break;
+#endif
+            default:
+                val->err_check_set(TEST_CHECKPOINT_NUM(204), VAL_STATUS_ERROR);
+                psa->reply(msg.handle, -2);
+                return VAL_STATUS_ERROR;
+        }
+    }
+}
@@ -0,0 +1,36 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _TEST_I095_DATA_H_
+#define _TEST_I095_DATA_H_
+
+/* Most handles held open at once, the SPM is expected to refuse a connection before.
+ * Can be tuned by the platform in pal_config.h
+ */
+#ifndef ARCH_TEST_CONNECT_SCALE_MAX_HANDLES
+#define ARCH_TEST_CONNECT_SCALE_MAX_HANDLES  64
+#endif
+
+/* Seed of the close order, 0 selects 1 */
+#ifndef ARCH_TEST_CONNECT_SCALE_SEED
+#define ARCH_TEST_CONNECT_SCALE_SEED         0x5EED
+#endif
+
+/* psa_call() type ending the server function once every handle is closed */
+#define CONNECT_SCALE_STOP                   1
+
+#endif /* _TEST_I095_DATA_H_ */
@@ -0,0 +1,276 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifdef NONSECURE_TEST_BUILD
+#include "val_interfaces.h"
+#include "val_target.h"
+#else
+#include "val_client_defs.h"
+#include "val_service_defs.h"
+#endif
+
+#include "test_i095.h"
+#include "test_data.h"
+
+#ifdef NONSECURE_TEST_BUILD
+
+const client_test_t test_i095_client_tests_list[] = {
+    NULL,
+    client_test_connect_pool_scaling,
+    NULL,
+};
+
+static psa_handle_t pool_handles[ARCH_TEST_CONNECT_SCALE_MAX_HANDLES];
+static uint32_t     pool_connect_ns[ARCH_TEST_CONNECT_SCALE_MAX_HANDLES];
+static uint32_t     pool_close_ns[ARCH_TEST_CONNECT_SCALE_MAX_HANDLES];
+static uint32_t     pool_order[ARCH_TEST_CONNECT_SCALE_MAX_HANDLES];
+static uint32_t     rand_state;
+
+/* xorshift32, keeps the close order identical across platforms for a given seed */
+static uint32_t pool_rand(void)
+{
+    rand_state ^= rand_state << 13;
+    rand_state ^= rand_state >> 17;
+    rand_state ^= rand_state << 5;
+    return rand_state;
+}
+
+static uint32_t pool_timestamp_elapsed(uint64_t start)
+{
+    uint64_t end = 0, elapsed;
+
+    if (val->get_timestamp(&end) != VAL_STATUS_SUCCESS)
+        return 0;
+    elapsed = (end > start) ? end - start : 0;
+    return (elapsed > INT32_MAX) ? INT32_MAX : (uint32_t)elapsed;
+}
+
+static uint64_t pool_timestamp(void)
+{
+    uint64_t timestamp = 0;
+
+    if (val->get_timestamp(&timestamp) != VAL_STATUS_SUCCESS)
+        timestamp = 0;
+    return timestamp;
+}
+
+/**
+    @brief    - Least squares slope of the samples against their index, which is the
+                number of handles open before the call
+    @param    - samples : Latency of each call
+                count   : Number of samples
+    @return   - Slope in pico seconds per open handle
+**/
+static int32_t pool_slope_ps(const uint32_t *samples, uint32_t count)
+{
+    int64_t n = count, sx = 0, sy = 0, sxx = 0, sxy = 0, den;
+    int64_t slope;
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        sx += i;
+        sy += samples[i];
+        sxx += (int64_t)i * i;
+        sxy += (int64_t)i * samples[i];
+    }
+
+    den = (n * sxx) - (sx * sx);
+    if (den == 0)
+        return 0;
+
+    slope = (1000 * ((n * sxy) - (sx * sy))) / den;
+    if (slope > INT32_MAX)
+        return INT32_MAX;
+    return (slope < INT32_MIN) ? INT32_MIN : (int32_t)slope;
+}
+
+/**
+    @brief    - Connects until the SPM refuses or ARCH_TEST_CONNECT_SCALE_MAX_HANDLES
+                handles are open, timing every psa_connect()
+    @param    - count      : Returns the number of open handles
+                refusal    : Returns the refusing psa_connect() return, PSA_NULL_HANDLE
+                             when the maximum was reached first
+                refusal_ns : Returns the latency of the refused psa_connect()
+**/
+static void pool_fill(uint32_t *count, psa_handle_t *refusal, uint32_t *refusal_ns)
+{
+    psa_handle_t handle;
+    uint64_t     start;
+    uint32_t     i;
+
+    *refusal = PSA_NULL_HANDLE;
+    *refusal_ns = 0;
+    for (i = 0; i < ARCH_TEST_CONNECT_SCALE_MAX_HANDLES; i++)
+    {
+        start = pool_timestamp();
+        handle = psa->connect(SERVER_UNSPECIFIED_VERSION_SID, SERVER_UNSPECIFIED_VERSION_VERSION);
+        if (!PSA_HANDLE_IS_VALID(handle))
+        {
+            *refusal_ns = pool_timestamp_elapsed(start);
+            *refusal = handle;
+            break;
+        }
+        pool_connect_ns[i] = pool_timestamp_elapsed(start);
+        pool_handles[i] = handle;
+    }
+    *count = i;
+}
+
+/**
+    @brief    - Closes the open handles in a random order, timing every psa_close()
+    @param    - count : Number of open handles
+**/
+static void pool_drain(uint32_t count)
+{
+    uint64_t start;
+    uint32_t i, j, tmp;
+
+    for (i = 0; i < count; i++)
+        pool_order[i] = i;
+    for (i = count; i > 1; i--)
+    {
+        j = pool_rand() % i;
+        tmp = pool_order[i - 1];
+        pool_order[i - 1] = pool_order[j];
+        pool_order[j] = tmp;
+    }
+
+    for (i = 0; i < count; i++)
+    {
+        start = pool_timestamp();
+        psa->close(pool_handles[pool_order[i]]);
+        pool_close_ns[i] = pool_timestamp_elapsed(start);
+        pool_handles[pool_order[i]] = PSA_NULL_HANDLE;
+    }
+}
+
+/**
+    @brief    - Fills then drains the pool and prints the latencies. Nothing is printed
+                while the pool is full, as printing may need a connection of its own.
+    @param    - fill  : Name of the fill in the [Series] lines
+                count : Returns the number of handles the pool held
+    @return   - val_status_t
+**/
+static int32_t pool_cycle(const char *fill, uint32_t *count)
+{
+    psa_handle_t refusal;
+    uint32_t     refusal_ns, i;
+
+    pool_fill(count, &refusal, &refusal_ns);
+    pool_drain(*count);
+
+    for (i = 0; i < *count; i++)
+    {
+        val->print(PRINT_TEST, "[Series] connect,", 0);
+        val->print(PRINT_TEST, (char *)fill, 0);
+        val->print(PRINT_TEST, ",%d,", (int32_t)i);
+        val->print(PRINT_TEST, "%d\n", (int32_t)pool_connect_ns[i]);
+    }
+
+    /* The i-th close is made with count - i handles open */
+    for (i = 0; i < *count; i++)
+    {
+        val->print(PRINT_TEST, "[Series] close,", 0);
+        val->print(PRINT_TEST, (char *)fill, 0);
+        val->print(PRINT_TEST, ",%d,", (int32_t)(*count - i));
+        val->print(PRINT_TEST, "%d\n", (int32_t)pool_close_ns[i]);
+    }
+
+    if (refusal == PSA_NULL_HANDLE)
+    {
+        val->print(PRINT_TEST, "[Info] No refusal within %d handles\n",
+                   ARCH_TEST_CONNECT_SCALE_MAX_HANDLES);
+        return VAL_STATUS_SUCCESS;
+    }
+
+    val->print(PRINT_TEST, "[Info] psa_connect refused at %d open handles", (int32_t)*count);
+    val->print(PRINT_TEST, " with %d", (int32_t)refusal);
+    val->print(PRINT_TEST, " in %d ns\n", (int32_t)refusal_ns);
+
+    /* Only the SPM running out of connections may refuse, the service accepts them all */
+    if ((refusal != PSA_ERROR_CONNECTION_BUSY) && (refusal != PSA_ERROR_CONNECTION_REFUSED))
+    {
+        val->print(PRINT_ERROR, "\tUnexpected psa_connect return %d\n", (int32_t)refusal);
+        return VAL_STATUS_INVALID_HANDLE;
+    }
+    return VAL_STATUS_SUCCESS;
+}
+
+static int32_t pool_stop_server(void)
+{
+    psa_handle_t handle;
+    psa_status_t status;
+
+    handle = psa->connect(SERVER_UNSPECIFIED_VERSION_SID, SERVER_UNSPECIFIED_VERSION_VERSION);
+    if (!PSA_HANDLE_IS_VALID(handle))
+    {
+        val->print(PRINT_ERROR, "\tConnection failed once the pool was drained\n", 0);
+        return VAL_STATUS_CONNECTION_FAILED;
+    }
+
+    status = psa->call(handle, CONNECT_SCALE_STOP, NULL, 0, NULL, 0);
+    psa->close(handle);
+    return (status == PSA_SUCCESS) ? VAL_STATUS_SUCCESS : VAL_STATUS_CALL_FAILED;
+}
+
+int32_t client_test_connect_pool_scaling(caller_security_t caller __UNUSED)
+{
+    uint32_t      first_count, refill_count;
+    int32_t       status;
+
+    val->print(PRINT_TEST, "[Check 1] Test psa_connect and psa_close against open handles\n", 0);
+
+    rand_state = ARCH_TEST_CONNECT_SCALE_SEED ? ARCH_TEST_CONNECT_SCALE_SEED : 1;
+    val->print(PRINT_TEST, "[Info] Seed 0x%x\n", (int32_t)rand_state);
+    val->print(PRINT_TEST, "[Series] op,fill,open_handles,latency_ns\n", 0);
+
+    /* Fill the pool, then close in random order so the free slots are scattered */
+    status = pool_cycle("first", &first_count);
+    if (VAL_ERROR(status))
+        return status;
+    if (first_count == 0)
+    {
+        val->print(PRINT_ERROR, "\tNo connection accepted\n", 0);
+        return VAL_STATUS_CONNECTION_FAILED;
+    }
+    val->print(PRINT_TEST, "[Info] psa_connect slope %d ps per open handle\n",
+               pool_slope_ps(pool_connect_ns, first_count));
+
+    /* Every handle closed must be available again */
+    status = pool_cycle("refill", &refill_count);
+    if (VAL_ERROR(status))
+        return status;
+    if (refill_count < first_count)
+    {
+        val->print(PRINT_ERROR, "\tOnly %d handles reopened after the random close\n",
+                   (int32_t)refill_count);
+        return VAL_STATUS_CONNECTION_FAILED;
+    }
+
+    return pool_stop_server();
+}
+
+#else
+
+/* Filling the pool from a secure client is a PROGRAMMER ERROR */
+const client_test_t test_i095_client_tests_list[] = {
+    NULL,
+    NULL,
+};
+
+#endif
@@ -0,0 +1,75 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_client_defs.h"
+#include "val_service_defs.h"
+#include "test_data.h"
+
+#define val CONCAT(val, _server_sp)
+#define psa CONCAT(psa, _server_sp)
+extern val_api_t *val;
+extern psa_api_t *psa;
+
+int32_t server_test_connect_pool_scaling(void);
+
+const server_test_t test_i095_server_tests_list[] = {
+    NULL,
+    server_test_connect_pool_scaling,
+    NULL,
+};
+
+/**
+    @brief    - Accepts every connection and serves the disconnects until the client
+                has sent CONNECT_SCALE_STOP and closed all its handles
+    @return   - val_status_t
+**/
+int32_t server_test_connect_pool_scaling(void)
+{
+    psa_msg_t   msg = {0};
+    uint32_t    open = 0, stopping = 0;
+
+    while (1)
+    {
+        if ((psa->wait(SERVER_UNSPECIFIED_VERSION_SIGNAL, PSA_BLOCK) &
+             SERVER_UNSPECIFIED_VERSION_SIGNAL) == 0)
+            continue;
+        if (psa->get(SERVER_UNSPECIFIED_VERSION_SIGNAL, &msg) != PSA_SUCCESS)
+            continue;
+
+        switch (msg.type)
+        {
+            case PSA_IPC_CONNECT:
+                open++;
+                psa->reply(msg.handle, PSA_SUCCESS);
+                break;
+            case PSA_IPC_DISCONNECT:
+                open--;
+                psa->reply(msg.handle, PSA_SUCCESS);
+                if (stopping && (open == 0))
+                    return VAL_STATUS_SUCCESS;
+                break;
+            case CONNECT_SCALE_STOP:
+                stopping = 1;
+                psa->reply(msg.handle, PSA_SUCCESS);
+                break;
+            default:
+                val->err_check_set(TEST_CHECKPOINT_NUM(201), VAL_STATUS_ERROR);
+                psa->reply(msg.handle, -2);
+                return VAL_STATUS_ERROR;
+        }
+    }
+}
@@ -0,0 +1,41 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _TEST_I096_DATA_H_
+#define _TEST_I096_DATA_H_
+
+/* Calls of each model per payload size. Can be tuned by the platform in pal_config.h */
+#ifndef ARCH_TEST_IPC_AB_ITERATIONS
+#define ARCH_TEST_IPC_AB_ITERATIONS  64
+#endif
+
+/* Payload sizes echoed by both RoT Services, in bytes */
+#define IPC_AB_NUM_SIZES             4
+#define IPC_AB_SIZES                 {0, 16, 256, 1024}
+#define IPC_AB_MAX_SIZE              1024
+
+/* psa_call() types of SERVER_AB_CONNECTION_BASED and SERVER_AB_STATELESS */
+#define IPC_AB_ECHO                  0
+#define IPC_AB_STOP                  1
+
+/* Call sequences run over both models, rotated every iteration */
+#define IPC_AB_SEQ_CONN_CALL         0
+#define IPC_AB_SEQ_STATELESS_CALL    1
+#define IPC_AB_SEQ_CONN_TXN          2
+#define IPC_AB_NUM_SEQS              3
+
+#endif /* _TEST_I096_DATA_H_ */
@@ -0,0 +1,237 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifdef NONSECURE_TEST_BUILD
+#include "val_interfaces.h"
+#include "val_target.h"
+#else
+#include "val_client_defs.h"
+#include "val_service_defs.h"
+#endif
+
+#include "test_i096.h"
+#include "test_data.h"
+
+const client_test_t test_i096_client_tests_list[] = {
+    NULL,
+    client_test_stateless_vs_connection,
+    NULL,
+};
+
+#if SPEC_VERSION == 11
+
+static const uint32_t ipc_ab_sizes[IPC_AB_NUM_SIZES] = IPC_AB_SIZES;
+
+static uint8_t  ipc_ab_in[IPC_AB_MAX_SIZE];
+static uint8_t  ipc_ab_out[IPC_AB_MAX_SIZE];
+static uint32_t ipc_ab_ns[IPC_AB_NUM_SEQS][ARCH_TEST_IPC_AB_ITERATIONS];
+
+static int32_t ipc_ab_to_print(int64_t value)
+{
+    if (value > INT32_MAX)
+        return INT32_MAX;
+    return (value < INT32_MIN) ? INT32_MIN : (int32_t)value;
+}
+
+static uint64_t ipc_ab_timestamp(void)
+{
+    uint64_t timestamp = 0;
+
+    if (val->get_timestamp(&timestamp) != VAL_STATUS_SUCCESS)
+        timestamp = 0;
+    return timestamp;
+}
+
+static uint32_t ipc_ab_elapsed(uint64_t start)
+{
+    uint64_t end = ipc_ab_timestamp();
+    uint64_t elapsed = (end > start) ? end - start : 0;
+
+    return (elapsed > UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsed;
+}
+
+/* Shell sort, the samples are only ordered to read the percentiles */
+static void ipc_ab_sort(uint32_t *data, uint32_t count)
+{
+    uint32_t gap, i, j, value;
+
+    for (gap = count / 2; gap > 0; gap /= 2)
+    {
+        for (i = gap; i < count; i++)
+        {
+            value = data[i];
+            for (j = i; (j >= gap) && (data[j - gap] > value); j -= gap)
+                data[j] = data[j - gap];
+            data[j] = value;
+        }
+    }
+}
+
+static uint32_t ipc_ab_percentile(const uint32_t *sorted, uint32_t count, uint32_t pct)
+{
+    return sorted[((count - 1) * pct) / 100];
+}
+
+/**
+    @brief    - Sends the payload to the echo service of one model and times the call
+    @param    - handle : Connection handle or stateless handle
+                size   : Payload size
+                ns     : Returns the psa_call() latency
+    @return   - val_status_t
+**/
+static int32_t ipc_ab_echo(psa_handle_t handle, uint32_t size, uint32_t *ns)
+{
+    psa_invec    invec[1] = {{ipc_ab_in, size}};
+    psa_outvec   outvec[1] = {{ipc_ab_out, size}};
+    psa_status_t status;
+    uint64_t     start;
+
+    memset(ipc_ab_out, 0, size);
+    start = ipc_ab_timestamp();
+    status = psa->call(handle, IPC_AB_ECHO, invec, 1, outvec, 1);
+    *ns = ipc_ab_elapsed(start);
+
+    if ((status != PSA_SUCCESS) || (outvec[0].len != size) ||
+        (memcmp(ipc_ab_in, ipc_ab_out, size) != 0))
+    {
+        val->print(PRINT_ERROR, "\tEcho of %d bytes failed\n", (int32_t)size);
+        return VAL_STATUS_CALL_FAILED;
+    }
+    return VAL_STATUS_SUCCESS;
+}
+
+/**
+    @brief    - Runs one call sequence over its model
+    @param    - seq    : IPC_AB_SEQ_<sequence>
+                handle : Persistent connection of SERVER_AB_CONNECTION_BASED
+                size   : Payload size
+                ns     : Returns the latency of the whole sequence
+    @return   - val_status_t
+**/
+static int32_t ipc_ab_run_seq(uint32_t seq, psa_handle_t handle, uint32_t size, uint32_t *ns)
+{
+    psa_handle_t txn_handle;
+    uint32_t     call_ns;
+    uint64_t     start;
+    int32_t      status;
+
+    switch (seq)
+    {
+        case IPC_AB_SEQ_CONN_CALL:
+            return ipc_ab_echo(handle, size, ns);
+        case IPC_AB_SEQ_STATELESS_CALL:
+            return ipc_ab_echo(SERVER_AB_STATELESS_HANDLE, size, ns);
+        default:
+            /* A client holding no connection pays psa_connect and psa_close per call */
+            start = ipc_ab_timestamp();
+            txn_handle = psa->connect(SERVER_AB_CONNECTION_BASED_SID,
+                                      SERVER_AB_CONNECTION_BASED_VERSION);
+            if (!PSA_HANDLE_IS_VALID(txn_handle))
+            {
+                val->print(PRINT_ERROR, "\tConnection failed\n", 0);
+                return VAL_STATUS_CONNECTION_FAILED;
+            }
+            status = ipc_ab_echo(txn_handle, size, &call_ns);
+            psa->close(txn_handle);
+            *ns = ipc_ab_elapsed(start);
+            return status;
+    }
+}
+
+int32_t client_test_stateless_vs_connection(caller_security_t caller __UNUSED)
+{
+    psa_handle_t handle;
+    uint32_t     size_idx, size, iter, k, seq, i;
+    uint32_t     conn_p50, stateless_p50, txn_p50;
+    int32_t      status = VAL_STATUS_SUCCESS;
+    psa_status_t stop_status;
+
+    val->print(PRINT_TEST, "[Check 1] Test stateless and connection based call overhead\n", 0);
+
+    for (i = 0; i < IPC_AB_MAX_SIZE; i++)
+        ipc_ab_in[i] = (uint8_t)(i ^ 0xA5);
+
+    handle = psa->connect(SERVER_AB_CONNECTION_BASED_SID, SERVER_AB_CONNECTION_BASED_VERSION);
+    if (!PSA_HANDLE_IS_VALID(handle))
+    {
+        val->print(PRINT_ERROR, "\tConnection failed\n", 0);
+        return VAL_STATUS_CONNECTION_FAILED;
+    }
+
+    val->print(PRINT_TEST, "[Series] size,conn_call_p50_ns,stateless_call_p50_ns,"
+               "delta_call_ns,conn_txn_p50_ns,delta_txn_ns\n", 0);
+    for (size_idx = 0; size_idx < IPC_AB_NUM_SIZES; size_idx++)
+    {
+        size = ipc_ab_sizes[size_idx];
+
+        /* Both models run the same sequences, the first one changes every iteration
+         * so neither model always finds the caches warmed by the other
+         */
+        for (iter = 0; iter < ARCH_TEST_IPC_AB_ITERATIONS; iter++)
+        {
+            for (k = 0; k < IPC_AB_NUM_SEQS; k++)
+            {
+                seq = (iter + k) % IPC_AB_NUM_SEQS;
+                status = ipc_ab_run_seq(seq, handle, size, &ipc_ab_ns[seq][iter]);
+                if (VAL_ERROR(status))
+                    goto exit;
+            }
+        }
+
+        for (seq = 0; seq < IPC_AB_NUM_SEQS; seq++)
+            ipc_ab_sort(ipc_ab_ns[seq], ARCH_TEST_IPC_AB_ITERATIONS);
+        conn_p50 = ipc_ab_percentile(ipc_ab_ns[IPC_AB_SEQ_CONN_CALL],
+                                     ARCH_TEST_IPC_AB_ITERATIONS, 50);
+        stateless_p50 = ipc_ab_percentile(ipc_ab_ns[IPC_AB_SEQ_STATELESS_CALL],
+                                          ARCH_TEST_IPC_AB_ITERATIONS, 50);
+        txn_p50 = ipc_ab_percentile(ipc_ab_ns[IPC_AB_SEQ_CONN_TXN],
+                                    ARCH_TEST_IPC_AB_ITERATIONS, 50);
+
+        /* A positive delta is the per-call overhead of the connection based model */
+        val->print(PRINT_TEST, "[Series] %d,", (int32_t)size);
+        val->print(PRINT_TEST, "%d,", ipc_ab_to_print(conn_p50));
+        val->print(PRINT_TEST, "%d,", ipc_ab_to_print(stateless_p50));
+        val->print(PRINT_TEST, "%d,", ipc_ab_to_print((int64_t)conn_p50 - stateless_p50));
+        val->print(PRINT_TEST, "%d,", ipc_ab_to_print(txn_p50));
+        val->print(PRINT_TEST, "%d\n", ipc_ab_to_print((int64_t)txn_p50 - stateless_p50));
+    }
+
+exit:
+    /* psa_close() returns once the disconnect is served, so the stateless service
+     * is the last one the server function waits on
+     */
+    psa->close(handle);
+    stop_status = psa->call(SERVER_AB_STATELESS_HANDLE, IPC_AB_STOP, NULL, 0, NULL, 0);
+    if ((status == VAL_STATUS_SUCCESS) && (stop_status != PSA_SUCCESS))
+    {
+        val->print(PRINT_ERROR, "\tFailed to stop the server\n", 0);
+        status = VAL_STATUS_CALL_FAILED;
+    }
+    return status;
+}
+
+#else
+
+int32_t client_test_stateless_vs_connection(caller_security_t caller __UNUSED)
+{
+    val->print(PRINT_TEST, "[Check 1] Test stateless and connection based call overhead\n", 0);
+    val->print(PRINT_TEST, "\tSkipping test as the A/B services are only in the FF 1.1 manifests,"
+               " build with -DSPEC_VERSION=1.1\n", 0);
+    return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+}
+
+#endif
@@ -0,0 +1,107 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include "val_client_defs.h"
+#include "val_service_defs.h"
+#include "test_data.h"
+
+#define val CONCAT(val, _server_sp)
+#define psa CONCAT(psa, _server_sp)
+extern val_api_t *val;
+extern psa_api_t *psa;
+
+int32_t server_test_stateless_vs_connection(void);
+
+const server_test_t test_i096_server_tests_list[] = {
+    NULL,
+    server_test_stateless_vs_connection,
+    NULL,
+};
+
+#if SPEC_VERSION == 11
+
+static uint8_t ipc_ab_buf[IPC_AB_MAX_SIZE];
+
+/**
+    @brief    - Serves one message of SERVER_AB_CONNECTION_BASED or SERVER_AB_STATELESS.
+                Both run the same echo so the models only differ by their SPM path.
+    @param    - signal : Service signal to get the message from
+                done   : Set when the stop call was served
+    @return   - val_status_t
+**/
+static int32_t ipc_ab_serve(psa_signal_t signal, uint32_t *done)
+{
+    psa_msg_t msg = {0};
+    size_t    size;
+
+    if (psa->get(signal, &msg) != PSA_SUCCESS)
+        return VAL_STATUS_SUCCESS;
+
+    switch (msg.type)
+    {
+        case PSA_IPC_CONNECT:
+        case PSA_IPC_DISCONNECT:
+            psa->reply(msg.handle, PSA_SUCCESS);
+            return VAL_STATUS_SUCCESS;
+        case IPC_AB_ECHO:
+            size = msg.in_size[0];
+            if ((size > IPC_AB_MAX_SIZE) || (msg.out_size[0] < size))
+                break;
+            if (psa->read(msg.handle, 0, ipc_ab_buf, size) != size)
+                break;
+            psa->write(msg.handle, 0, ipc_ab_buf, size);
+            psa->reply(msg.handle, PSA_SUCCESS);
+            return VAL_STATUS_SUCCESS;
+        case IPC_AB_STOP:
+            *done = 1;
+            psa->reply(msg.handle, PSA_SUCCESS);
+            return VAL_STATUS_SUCCESS;
+        default:
+            break;
+    }
+
+    val->err_check_set(TEST_CHECKPOINT_NUM(201), VAL_STATUS_ERROR);
+    psa->reply(msg.handle, -2);
+    return VAL_STATUS_ERROR;
+}
+
+int32_t server_test_stateless_vs_connection(void)
+{
+    psa_signal_t signals;
+    uint32_t     done = 0;
+    int32_t      status = VAL_STATUS_SUCCESS;
+
+    while (!done && (status == VAL_STATUS_SUCCESS))
+    {
+        signals = psa->wait(SERVER_AB_CONNECTION_BASED_SIGNAL | SERVER_AB_STATELESS_SIGNAL,
+                            PSA_BLOCK);
+        if (signals & SERVER_AB_CONNECTION_BASED_SIGNAL)
+            status = ipc_ab_serve(SERVER_AB_CONNECTION_BASED_SIGNAL, &done);
+        if ((status == VAL_STATUS_SUCCESS) && (signals & SERVER_AB_STATELESS_SIGNAL))
+            status = ipc_ab_serve(SERVER_AB_STATELESS_SIGNAL, &done);
+    }
+    return status;
+}
+
+#else
+
+int32_t server_test_stateless_vs_connection(void)
+{
+    return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+}
+
+#endif
@@ -0,0 +1,26 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _TEST_I097_DATA_H_
+#define _TEST_I097_DATA_H_
+
+/* Most cases of the isolation matrix whose latency is kept for the percentiles */
+#ifndef ARCH_TEST_ISOLATION_MATRIX_MAX_CASES
+#define ARCH_TEST_ISOLATION_MATRIX_MAX_CASES  256
+#endif
+
+#endif /* _TEST_I097_DATA_H_ */
@@ -0,0 +1,151 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifdef NONSECURE_TEST_BUILD
+#include "val_interfaces.h"
+#include "val_target.h"
+#else
+#include "val_client_defs.h"
+#include "val_service_defs.h"
+#endif
+
+#include "test_i097.h"
+#include "test_data.h"
+
+#ifdef NONSECURE_TEST_BUILD
+
+const client_test_t test_i097_client_tests_list[] = {
+    NULL,
+    client_test_isolation_matrix,
+    NULL,
+};
+
+static uint32_t iso_fault_ns[ARCH_TEST_ISOLATION_MATRIX_MAX_CASES];
+static uint32_t iso_access_ns[ARCH_TEST_ISOLATION_MATRIX_MAX_CASES];
+
+/* Shell sort, the samples are only ordered to read the percentiles */
+static void iso_sort(uint32_t *data, uint32_t count)
+{
+    uint32_t gap, i, j, value;
+
+    for (gap = count / 2; gap > 0; gap /= 2)
+    {
+        for (i = gap; i < count; i++)
+        {
+            value = data[i];
+            for (j = i; (j >= gap) && (data[j - gap] > value); j -= gap)
+                data[j] = data[j - gap];
+            data[j] = value;
+        }
+    }
+}
+
+static int32_t iso_to_print(uint32_t value)
+{
+    return (value > INT32_MAX) ? INT32_MAX : (int32_t)value;
+}
+
+/**
+    @brief    - Prints the latency percentiles of one outcome of the matrix
+    @param    - outcome : "fault" or "access"
+                samples : Latencies, sorted in place
+                count   : Number of samples
+**/
+static void iso_report(const char *outcome, uint32_t *samples, uint32_t count)
+{
+    if (count == 0)
+        return;
+
+    iso_sort(samples, count);
+    val->print(PRINT_TEST, "[Info] ", 0);
+    val->print(PRINT_TEST, (char *)outcome, 0);
+    val->print(PRINT_TEST, " latency over %d cases:", (int32_t)count);
+    val->print(PRINT_TEST, " p50 %d ns,", iso_to_print(samples[(count - 1) / 2]));
+    val->print(PRINT_TEST, " max %d ns\n", iso_to_print(samples[count - 1]));
+}
+
+int32_t client_test_isolation_matrix(caller_security_t caller __UNUSED)
+{
+    isolation_case_t iso_case;
+    uint32_t         index, faults = 0, accesses = 0, mismatches = 0;
+    int32_t          status;
+
+    val->print(PRINT_TEST, "[Check 1] Test caller, region and access isolation matrix\n", 0);
+
+    for (index = 0; ; index++)
+    {
+        status = val->isolation_probe(index, &iso_case);
+        if (status == VAL_STATUS_UNSUPPORTED)
+        {
+            val->print(PRINT_TEST, "\tSkipping test as the platform cannot recover from"
+                       " an isolation fault\n", 0);
+            return RESULT_SKIP(VAL_STATUS_UNSUPPORTED);
+        }
+        if (status == VAL_STATUS_NOT_FOUND)
+            break;
+        if (VAL_ERROR(status))
+            return status;
+
+        if (index == 0)
+            val->print(PRINT_TEST, "[Series] caller,owner,region,access,expected,observed,"
+                       "latency_ns\n", 0);
+        val->print(PRINT_TEST, "[Series] ", 0);
+        val->print(PRINT_TEST, (char *)iso_case.caller, 0);
+        val->print(PRINT_TEST, ",", 0);
+        val->print(PRINT_TEST, (char *)iso_case.owner, 0);
+        val->print(PRINT_TEST, ",", 0);
+        val->print(PRINT_TEST, (char *)iso_case.region, 0);
+        val->print(PRINT_TEST, iso_case.write ? ",write" : ",read", 0);
+        val->print(PRINT_TEST, iso_case.expect_fault ? ",fault" : ",access", 0);
+        val->print(PRINT_TEST, iso_case.faulted ? ",fault" : ",access", 0);
+        val->print(PRINT_TEST, ",%d\n", iso_to_print(iso_case.latency_ns));
+
+        if (iso_case.faulted != iso_case.expect_fault)
+            mismatches++;
+
+        if (iso_case.faulted && (faults < ARCH_TEST_ISOLATION_MATRIX_MAX_CASES))
+            iso_fault_ns[faults++] = iso_case.latency_ns;
+        else if (!iso_case.faulted && (accesses < ARCH_TEST_ISOLATION_MATRIX_MAX_CASES))
+            iso_access_ns[accesses++] = iso_case.latency_ns;
+    }
+
+    iso_report("Fault", iso_fault_ns, faults);
+    iso_report("Access", iso_access_ns, accesses);
+
+    if (index == 0)
+    {
+        val->print(PRINT_ERROR, "\tThe isolation matrix has no case\n", 0);
+        return VAL_STATUS_ERROR;
+    }
+    if (mismatches)
+    {
+        val->print(PRINT_ERROR, "\t%d cases not isolated as expected\n", (int32_t)mismatches);
+        return VAL_STATUS_SPM_FAILED;
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
+
+#else
+
+/* The matrix covers the secure callers from the non-secure side */
+const client_test_t test_i097_client_tests_list[] = {
+    NULL,
+    NULL,
+};
+
+#endif
@@ -19,6 +19,9 @@
 #define DATA_VALUE  0x1111
 #define BUFFER_SIZE 4
 
+/* Most samples taken by a single irq latency request */
+#define DRIVER_IRQ_LATENCY_MAX_SAMPLES 256
+
 #if SPEC_VERSION == 11
 
 #define DRIVER_UART_INTR_SIG DRIVER_UART_INTR_SIG_SIGNAL
@@ -31,6 +34,7 @@ int32_t driver_test_psa_eoi_with_non_intr_signal(void);
 int32_t driver_test_psa_eoi_with_unasserted_signal(void);
 int32_t driver_test_psa_eoi_with_multiple_signals(void);
 int32_t driver_test_irq_routing(void);
+void driver_test_irq_latency(psa_msg_t *msg);
 void driver_test_isolation_psa_rot_data_rd(psa_msg_t *msg);
 void driver_test_isolation_psa_rot_data_wr(psa_msg_t *msg);
 void driver_test_isolation_psa_rot_stack_rd(psa_msg_t *msg);
@@ -264,6 +268,9 @@ void driver_main(void)
                              else
                                  psa_reply(msg.handle, PSA_SUCCESS);
                              break;
+                        case TEST_IRQ_LATENCY:
+                             driver_test_irq_latency(&msg);
+                             break;
                         case TEST_ISOLATION_PSA_ROT_DATA_RD:
                              driver_test_isolation_psa_rot_data_rd(&msg);
                              break;
@@ -448,6 +455,74 @@ int32_t driver_test_irq_routing(void)
     }
 }
 
+static uint32_t driver_irq_elapsed(uint64_t start, uint64_t end)
+{
+    uint64_t elapsed = (end > start) ? end - start : 0;
+
+    return (elapsed > UINT32_MAX) ? UINT32_MAX : (uint32_t)elapsed;
+}
+
+/**
+    @brief   - Times the interrupt path of the driver partition. Every sample raises
+               the irq with val_generate_interrupt(), waits for the irq signal, then
+               lowers the irq and performs psa_eoi(). Invec 1 holds the number of
+               samples, outvec 0 returns the generate to psa_wait() delivery time and
+               outvec 1 the psa_wait() to psa_eoi() completion time of every sample,
+               in nano seconds of the driver partition timestamp.
+    @param   - msg : Call message of the request
+    @return  - void
+**/
+void driver_test_irq_latency(psa_msg_t *msg)
+{
+    static uint32_t delivery_ns[DRIVER_IRQ_LATENCY_MAX_SAMPLES];
+    static uint32_t eoi_ns[DRIVER_IRQ_LATENCY_MAX_SAMPLES];
+    psa_signal_t    signals;
+    uint64_t        start, delivered, done;
+    uint32_t        samples = 0, i;
+
+    if ((msg->in_size[1] != sizeof(samples)) ||
+        (psa_read(msg->handle, 1, &samples, sizeof(samples)) != sizeof(samples)))
+    {
+        psa_reply(msg->handle, VAL_STATUS_ERROR);
+        return;
+    }
+
+    /* Never return more samples than both outvecs hold */
+    if (samples > DRIVER_IRQ_LATENCY_MAX_SAMPLES)
+        samples = DRIVER_IRQ_LATENCY_MAX_SAMPLES;
+    if (samples > msg->out_size[0] / sizeof(uint32_t))
+        samples = msg->out_size[0] / sizeof(uint32_t);
+    if (samples > msg->out_size[1] / sizeof(uint32_t))
+        samples = msg->out_size[1] / sizeof(uint32_t);
+
+    psa_irq_enable(DRIVER_UART_INTR_SIG);
+
+    for (i = 0; i < samples; i++)
+    {
+        val_get_timestamp_sf(&start);
+        val_generate_interrupt();
+        signals = psa_wait(DRIVER_UART_INTR_SIG, PSA_BLOCK);
+        val_get_timestamp_sf(&delivered);
+
+        val_disable_interrupt();
+        if ((signals & DRIVER_UART_INTR_SIG) == 0)
+        {
+            val_print_sf("\tFailed to receive irq signal, signals=0x%x\n", signals);
+            psa_reply(msg->handle, VAL_STATUS_ERROR);
+            return;
+        }
+        psa_eoi(DRIVER_UART_INTR_SIG);
+        val_get_timestamp_sf(&done);
+
+        delivery_ns[i] = driver_irq_elapsed(start, delivered);
+        eoi_ns[i] = driver_irq_elapsed(delivered, done);
+    }
+
+    psa_write(msg->handle, 0, delivery_ns, samples * sizeof(uint32_t));
+    psa_write(msg->handle, 1, eoi_ns, samples * sizeof(uint32_t));
+    psa_reply(msg->handle, PSA_SUCCESS);
+}
+
 static int32_t process_call_request(psa_signal_t sig, psa_msg_t *msg)
 {
     val_status_t res = VAL_STATUS_ERROR;
@@ -19,14 +19,29 @@
 
 #define PSA_ALG_MD4 ((psa_algorithm_t)0x02000002)
 
-static uint32_t         public_key_registered;
-static psa_key_handle_t public_key_handle;
-
-static inline struct q_useful_buf_c useful_buf_head(struct q_useful_buf_c buf,
-                                                  size_t amount)
-{
-    return UsefulBuf_Head(buf, amount);
-}
+/* Algorithm the attestation public key is imported for */
+#define PAL_ATTEST_KEY_ALG PSA_ALG_ECDSA(PSA_ALG_SHA_256)
+
+/* Imported attestation public keys, kept across verifications */
+typedef struct {
+    uint8_t          key_id[PAL_ATTEST_KEY_ID_SIZE];
+    psa_algorithm_t  key_alg;
+    psa_key_handle_t handle;
+    uint32_t         valid;
+} pal_attest_key_entry_t;
+
+static pal_attest_key_entry_t attest_key_cache[PAL_ATTEST_KEY_CACHE_SIZE];
+static uint32_t               attest_key_cache_next;
+
+/* Set by pal_crypto_pub_key_cache_load() for concurrent verifications, which only
+ * read the cache. A miss then verifies with a key imported for that verification.
+ */
+static uint32_t               attest_key_cache_read_only;
+
+/* Signing algorithms of the tokens, preloaded by pal_crypto_pub_key_cache_load() */
+static const int32_t attest_sig_alg_ids[] = {
+    COSE_ALGORITHM_ES256, COSE_ALGORITHM_ES384, COSE_ALGORITHM_ES512
+};
 
 static psa_algorithm_t cose_hash_alg_id_to_psa(int32_t cose_hash_alg_id)
 {
@@ -37,11 +52,18 @@ static psa_algorithm_t cose_hash_alg_id_to_psa(int32_t cose_hash_alg_id)
     case COSE_ALG_SHA256_PROPRIETARY:
         status = PSA_ALG_SHA_256;
         break;
+    case COSE_ALGORITHM_SHA_384:
+        status = PSA_ALG_SHA_384;
+        break;
+    case COSE_ALGORITHM_SHA_512:
+        status = PSA_ALG_SHA_512;
+        break;
     case PSA_ALG_MD4:
         status = PSA_ALG_MD4;
         break;
     default:
-        status = PSA_ALG_MD5;
+        /* Not a hash algorithm, psa_hash_setup() rejects it */
+        status = 0;
         break;
     }
 
@@ -54,11 +76,72 @@ static int32_t hash_alg_id_from_sig_alg_id(int32_t cose_sig_alg_id)
     {
         case COSE_ALGORITHM_ES256:
             return COSE_ALG_SHA256_PROPRIETARY;
+        case COSE_ALGORITHM_ES384:
+            return COSE_ALGORITHM_SHA_384;
+        case COSE_ALGORITHM_ES512:
+            return COSE_ALGORITHM_SHA_512;
         default:
             return INT32_MAX;
     }
 }
 
+static psa_algorithm_t key_alg_from_sig_alg_id(int32_t cose_sig_alg_id)
+{
+    switch (cose_sig_alg_id)
+    {
+        case COSE_ALGORITHM_ES384:
+            return PSA_ALG_ECDSA(PSA_ALG_SHA_384);
+        case COSE_ALGORITHM_ES512:
+            return PSA_ALG_ECDSA(PSA_ALG_SHA_512);
+        default:
+            return PAL_ATTEST_KEY_ALG;
+    }
+}
+
+/**
+    @brief    - Encodes the head of a CBOR data item
+    @param    - major_type : PAL_CBOR_MAJOR_* type
+                value      : Length or value carried by the head
+                head       : Returns the head, PAL_CBOR_HEAD_MAX_SIZE bytes at most
+    @return   - Size of the head
+**/
+static size_t pal_cbor_encode_head(uint8_t major_type, uint64_t value, uint8_t *head)
+{
+    size_t  size, i;
+
+    if (value < 24)
+    {
+        head[0] = major_type | (uint8_t)value;
+        return 1;
+    }
+
+    if (value <= UINT8_MAX)
+    {
+        head[0] = major_type | 24;
+        size = 1;
+    }
+    else if (value <= UINT16_MAX)
+    {
+        head[0] = major_type | 25;
+        size = 2;
+    }
+    else if (value <= UINT32_MAX)
+    {
+        head[0] = major_type | 26;
+        size = 4;
+    }
+    else
+    {
+        head[0] = major_type | 27;
+        size = 8;
+    }
+
+    for (i = 0; i < size; i++)
+        head[size - i] = (uint8_t)(value >> (8 * i));
+
+    return size + 1;
+}
+
 int32_t pal_cose_crypto_hash_start(psa_hash_operation_t *psa_hash, int32_t cose_hash_alg_id)
 {
     psa_algorithm_t      psa_alg;
@@ -126,69 +209,72 @@ Done:
     return status;
 }
 
+/**
+    @brief    - Hashes the COSE Sig_structure of a COSE_Sign1 token,
+                [ "Signature1", protected_headers, external_aad, payload ]
+                The CBOR heads are encoded on the stack while the protected
+                headers and the payload are hashed in place from the token.
+    @param    - cose_alg_id       : Signing algorithm of the token
+                buffer_for_hash   : Buffer for the hash
+                hash              : Returns the hash
+                protected_headers : Protected headers, in the token
+                payload           : Payload, in the token
+    @return   - error status
+**/
 uint32_t pal_compute_hash(int32_t cose_alg_id, struct q_useful_buf buffer_for_hash,
                           struct q_useful_buf_c *hash, struct q_useful_buf_c protected_headers,
                           struct q_useful_buf_c payload)
 {
     uint32_t                    status;
-    QCBOREncodeContext          cbor_encode_ctx;
-    struct q_useful_buf_c       tbs_first_part;
-    QCBORError                  qcbor_result;
     int32_t                     hash_alg_id;
-    UsefulBuf_MAKE_STACK_UB    (buffer_for_TBS_first_part, T_COSE_SIZE_OF_TBS);
+    size_t                      context_len = sizeof(COSE_SIG_CONTEXT_STRING_SIGNATURE1) - 1;
+    size_t                      len = 0;
+    uint8_t                     framing[2 * PAL_CBOR_HEAD_MAX_SIZE +
+                                        sizeof(COSE_SIG_CONTEXT_STRING_SIGNATURE1)];
+    struct q_useful_buf_c       framing_buf;
     psa_hash_operation_t        psa_hash = PSA_HASH_OPERATION_INIT;
 
-    /* This builds the CBOR-format to-be-signed bytes */
-    QCBOREncode_Init(&cbor_encode_ctx, buffer_for_TBS_first_part);
-    QCBOREncode_OpenArray(&cbor_encode_ctx);
-
-    /* context */
-    QCBOREncode_AddSZString(&cbor_encode_ctx, COSE_SIG_CONTEXT_STRING_SIGNATURE1);
-
-    /* body_protected */
-    QCBOREncode_AddBytes(&cbor_encode_ctx, protected_headers);
-
-    /* sign_protected is not used for Sign1 */
-    /* external_aad */
-    QCBOREncode_AddBytes(&cbor_encode_ctx, NULL_USEFUL_BUF_C);
-
-    /* The short fake payload. */
-    QCBOREncode_AddBytesLenOnly(&cbor_encode_ctx, payload);
-    QCBOREncode_CloseArray(&cbor_encode_ctx);
-
-    /* Get the result and convert it to struct q_useful_buf_c representation */
-    qcbor_result = QCBOREncode_Finish(&cbor_encode_ctx, &tbs_first_part);
-    if (qcbor_result)
-    {
-        /* Mainly means that the protected_headers were too big
-         * (which should never happen)
-         */
-        status = PAL_ATTEST_ERR_SIGN_STRUCT;
-        goto Done;
-    }
-
     /* Start the hashing */
     hash_alg_id = hash_alg_id_from_sig_alg_id(cose_alg_id);
+    if (hash_alg_id == INT32_MAX)
+        return PAL_ATTEST_HASH_UNSUPPORTED;
 
-    /* Don't check hash_alg_id for failure. pal_cose_crypto_hash_start()
-     * will handle it properly
-     */
     status = pal_cose_crypto_hash_start(&psa_hash, hash_alg_id);
     if (status)
-        goto Done;
+        return status;
+
+    framing_buf.ptr = framing;
+
+    /* Array of four, the context string and the head of body_protected */
+    framing[len++] = PAL_CBOR_MAJOR_ARRAY | 4;
+    len += pal_cbor_encode_head(PAL_CBOR_MAJOR_TEXT_STRING, context_len, &framing[len]);
+    memcpy(&framing[len], COSE_SIG_CONTEXT_STRING_SIGNATURE1, context_len);
+    len += context_len;
+    len += pal_cbor_encode_head(PAL_CBOR_MAJOR_BYTE_STRING, protected_headers.len,
+                                &framing[len]);
+    framing_buf.len = len;
+    pal_cose_crypto_hash_update(&psa_hash, framing_buf);
+
+    /* body_protected */
+    pal_cose_crypto_hash_update(&psa_hash, protected_headers);
 
-    /* This is hashing of the first part, all the CBOR
-     * except the payload.
+    /* sign_protected is not used for Sign1, external_aad is an empty bstr,
+     * then the head of the payload.
      */
-    pal_cose_crypto_hash_update(&psa_hash, useful_buf_head(tbs_first_part, tbs_first_part.len));
+    len = 0;
+    framing[len++] = PAL_CBOR_MAJOR_BYTE_STRING;
+    len += pal_cbor_encode_head(PAL_CBOR_MAJOR_BYTE_STRING, payload.len, &framing[len]);
+    framing_buf.len = len;
+    pal_cose_crypto_hash_update(&psa_hash, framing_buf);
 
-    /* Hash the payload, the second part. */
+    /* Hash the payload */
     pal_cose_crypto_hash_update(&psa_hash, payload);
 
     /* Finish the hash and set up to return it */
     status = pal_cose_crypto_hash_finish(&psa_hash, buffer_for_hash, hash);
+    if (status != PSA_SUCCESS)
+        psa_hash_abort(&psa_hash);
 
-Done:
     return status;
 }
 
@@ -217,137 +303,268 @@ static int32_t pal_attest_get_public_key(uint8_t          *public_key_buff,
     return status;
 }
 
-static uint32_t pal_import_attest_key(psa_algorithm_t key_alg)
+static uint32_t pal_import_attest_key(psa_algorithm_t   key_alg,
+                                      const uint8_t    *public_key_buff,
+                                      size_t            public_key_size,
+                                      psa_ecc_family_t  ecc_family,
+                                      psa_key_handle_t *key_handle)
 {
-    psa_status_t     status             = PAL_ATTEST_ERROR;
+    psa_status_t     status;
     psa_key_usage_t  usage              = PSA_KEY_USAGE_VERIFY_HASH;
-    psa_ecc_family_t ecc_family;
     psa_key_type_t   attest_key_type;
-    size_t           public_key_size;
-    uint8_t          public_key_buff[ECC_CURVE_SECP256R1_PULBIC_KEY_LENGTH] = {0};
+
+    if (ecc_family == (psa_ecc_family_t)USHRT_MAX)
+        return PAL_ATTEST_ERROR;
+
+    /* Set key type for public key */
+    attest_key_type = PSA_KEY_TYPE_ECC_PUBLIC_KEY(ecc_family);
 
 #if defined(CRYPTO_VERSION_BETA1) || defined(CRYPTO_VERSION_BETA2)
     psa_key_policy_t policy;
 
-    if (!public_key_registered)
-    {
-        status = pal_attest_get_public_key(public_key_buff,
-                                           sizeof(public_key_buff),
-                                           &public_key_size,
-                                           &ecc_family);
-        if (status != PSA_SUCCESS)
-            return PAL_ATTEST_ERR_KEY_FAIL;
+    /* Setup the key policy for public key */
+    policy = psa_key_policy_init();
+    psa_key_policy_set_usage(&policy, usage, key_alg);
 
-        if (ecc_family == (psa_ecc_family_t)USHRT_MAX)
-            return PAL_ATTEST_ERROR;
+    status = psa_allocate_key(key_handle);
+    if (status != PSA_SUCCESS)
+        return PAL_ATTEST_ERR_KEY_FAIL;
 
-        /* Set key type for public key */
-        attest_key_type = PSA_KEY_TYPE_ECC_PUBLIC_KEY(ecc_family);
+    status = psa_set_key_policy(*key_handle, &policy);
+    if (status != PSA_SUCCESS)
+    {
+        psa_destroy_key(*key_handle);
+        return PAL_ATTEST_ERR_KEY_FAIL;
+    }
 
-        /* Setup the key policy for public key */
-        policy = psa_key_policy_init();
-        psa_key_policy_set_usage(&policy, usage, key_alg);
+    /* Import the public key */
+    status = psa_import_key(*key_handle,
+                            attest_key_type,
+                            public_key_buff,
+                            public_key_size);
+    if (status != PSA_SUCCESS)
+    {
+        psa_destroy_key(*key_handle);
+        return PAL_ATTEST_ERR_KEY_FAIL;
+    }
 
-        status = psa_allocate_key(&public_key_handle);
-        if (status != PSA_SUCCESS)
-            return PAL_ATTEST_ERR_KEY_FAIL;
+#elif defined(CRYPTO_VERSION_BETA3)
+    psa_key_attributes_t  attributes = PSA_KEY_ATTRIBUTES_INIT;
 
-        status = psa_set_key_policy(public_key_handle, &policy);
-        if (status != PSA_SUCCESS)
-            return PAL_ATTEST_ERR_KEY_FAIL;
+    /* Set the attributes for the public key */
+    psa_set_key_type(&attributes, attest_key_type);
+    psa_set_key_bits(&attributes, public_key_size);
+    psa_set_key_usage_flags(&attributes, usage);
+    psa_set_key_algorithm(&attributes, key_alg);
+    psa_set_key_bits(&attributes, 0);
+
+    /* Import the public key */
+    status = psa_import_key(&attributes,
+                            public_key_buff,
+                            public_key_size,
+                            key_handle);
+    if (status != PSA_SUCCESS)
+        return PAL_ATTEST_ERR_KEY_FAIL;
+#else
+    (void)usage;
+    (void)attest_key_type;
+    (void)key_alg;
+    (void)public_key_buff;
+    (void)public_key_size;
+    (void)key_handle;
+    status = PAL_ATTEST_ERR_KEY_FAIL;
+#endif
 
-        /* Import the public key */
-        status = psa_import_key(public_key_handle,
-                                attest_key_type,
-                                public_key_buff,
-                                public_key_size);
-        if (status != PSA_SUCCESS)
-            return PAL_ATTEST_ERR_KEY_FAIL;
+    return status;
+}
 
-        public_key_registered = 1;
+/**
+    @brief    - Looks up an imported attestation public key
+    @param    - key_alg : Algorithm the key is used with
+                key_id  : Identifier of the key, PAL_ATTEST_KEY_ID_SIZE bytes
+    @return   - Cache entry of the key, NULL on a miss
+**/
+static pal_attest_key_entry_t *pal_find_attest_key(psa_algorithm_t key_alg, const void *key_id)
+{
+    uint32_t i;
+
+    for (i = 0; i < PAL_ATTEST_KEY_CACHE_SIZE; i++)
+    {
+        if (attest_key_cache[i].valid && (attest_key_cache[i].key_alg == key_alg) &&
+            !memcmp(attest_key_cache[i].key_id, key_id, PAL_ATTEST_KEY_ID_SIZE))
+            return &attest_key_cache[i];
     }
 
-#elif defined(CRYPTO_VERSION_BETA3)
-    psa_key_attributes_t  attributes = PSA_KEY_ATTRIBUTES_INIT;
+    return NULL;
+}
 
-    if (!public_key_registered)
+/**
+    @brief    - Returns the handle of the imported attestation public key. The key
+                is looked up by the kid of the token first, and only fetched and
+                imported on a miss. It stays imported for the following
+                verifications until pal_crypto_pub_key_cache_invalidate().
+    @param    - key_alg    : Algorithm the key is used with
+                kid        : Key ID of the token, the SHA-256 of the key, or empty
+                key_handle : Returns the handle of the imported key
+                temporary  : Returns 1 when the key isn't cached and must be
+                             destroyed by the caller after use
+    @return   - error status
+**/
+static uint32_t pal_get_attest_key(psa_algorithm_t key_alg, struct q_useful_buf_c kid,
+                                   psa_key_handle_t *key_handle, uint32_t *temporary)
+{
+    uint32_t              status;
+    size_t                public_key_size;
+    psa_ecc_family_t      ecc_family;
+    uint8_t               public_key_buff[PAL_ATTEST_MAX_PUBLIC_KEY_SIZE] = {0};
+    struct q_useful_buf_c public_key;
+    struct q_useful_buf_c key_id;
+    pal_attest_key_entry_t *entry;
+    UsefulBuf_MAKE_STACK_UB(buffer_for_key_id, PAL_ATTEST_KEY_ID_SIZE);
+
+    *temporary = 0;
+    if (kid.len == PAL_ATTEST_KEY_ID_SIZE)
     {
-        status = pal_attest_get_public_key(public_key_buff,
-                                           sizeof(public_key_buff),
-                                           &public_key_size,
-                                           &ecc_family);
-        if (status != PSA_SUCCESS)
-            return PAL_ATTEST_ERR_KEY_FAIL;
+        entry = pal_find_attest_key(key_alg, kid.ptr);
+        if (entry != NULL)
+        {
+            *key_handle = entry->handle;
+            return PAL_ATTEST_SUCCESS;
+        }
+    }
 
-        if (ecc_family == (psa_ecc_family_t)USHRT_MAX)
-            return PAL_ATTEST_ERROR;
+    status = pal_attest_get_public_key(public_key_buff,
+                                       sizeof(public_key_buff),
+                                       &public_key_size,
+                                       &ecc_family);
+    if (status != PSA_SUCCESS)
+        return PAL_ATTEST_ERR_KEY_FAIL;
 
-        /* Set key type for public key */
-        attest_key_type = PSA_KEY_TYPE_ECC_PUBLIC_KEY(ecc_family);
+    /* Tokens without a kid, or with another one, find the key by its hash */
+    public_key.ptr = public_key_buff;
+    public_key.len = public_key_size;
+    status = pal_create_sha256(public_key, buffer_for_key_id, &key_id);
+    if ((status != PSA_SUCCESS) || (key_id.len != PAL_ATTEST_KEY_ID_SIZE))
+        return PAL_ATTEST_ERR_KEY_FAIL;
 
-        /* Set the attributes for the public key */
-        psa_set_key_type(&attributes, attest_key_type);
-        psa_set_key_bits(&attributes, public_key_size);
-        psa_set_key_usage_flags(&attributes, usage);
-        psa_set_key_algorithm(&attributes, key_alg);
-        psa_set_key_bits(&attributes, 0);
+    entry = pal_find_attest_key(key_alg, key_id.ptr);
+    if (entry != NULL)
+    {
+        *key_handle = entry->handle;
+        return PAL_ATTEST_SUCCESS;
+    }
 
-        /* Import the public key */
-        status = psa_import_key(&attributes,
-                                public_key_buff,
-                                public_key_size,
-                                &public_key_handle);
+    if (attest_key_cache_read_only)
+    {
+        status = pal_import_attest_key(key_alg, public_key_buff, public_key_size, ecc_family,
+                                       key_handle);
         if (status != PSA_SUCCESS)
             return PAL_ATTEST_ERR_KEY_FAIL;
 
-        public_key_registered = 1;
+        *temporary = 1;
+        return PAL_ATTEST_SUCCESS;
     }
-#endif
 
-    return status;
+    /* Miss, replace the entries in turn once the cache is full */
+    entry = &attest_key_cache[attest_key_cache_next];
+    attest_key_cache_next = (attest_key_cache_next + 1) % PAL_ATTEST_KEY_CACHE_SIZE;
+    if (entry->valid)
+    {
+        entry->valid = 0;
+        if (psa_destroy_key(entry->handle) != PSA_SUCCESS)
+            return PAL_ATTEST_ERR_KEY_FAIL;
+    }
+
+    status = pal_import_attest_key(key_alg, public_key_buff, public_key_size, ecc_family,
+                                   &entry->handle);
+    if (status != PSA_SUCCESS)
+        return PAL_ATTEST_ERR_KEY_FAIL;
+
+    memcpy(entry->key_id, key_id.ptr, PAL_ATTEST_KEY_ID_SIZE);
+    entry->key_alg = key_alg;
+    entry->valid   = 1;
+    *key_handle    = entry->handle;
+
+    return PAL_ATTEST_SUCCESS;
 }
 
-static uint32_t pal_destroy_attest_key(void)
+/**
+    @brief    - Destroys every cached attestation public key, the next
+                verification imports the key again. To be called when the
+                attestation key may have changed or the session ends.
+    @param    - void
+    @return   - error status
+**/
+uint32_t pal_crypto_pub_key_cache_invalidate(void)
 {
-    psa_status_t     status;
+    uint32_t status = PAL_ATTEST_SUCCESS;
+    uint32_t i;
 
-    if (!public_key_registered)
-        return PAL_ATTEST_ERR_KEY_FAIL;
+    for (i = 0; i < PAL_ATTEST_KEY_CACHE_SIZE; i++)
+    {
+        if (!attest_key_cache[i].valid)
+            continue;
 
-    status =  psa_destroy_key(public_key_handle);
-    if (status != PSA_SUCCESS)
-        return PAL_ATTEST_ERR_KEY_FAIL;
+        attest_key_cache[i].valid = 0;
+        if (psa_destroy_key(attest_key_cache[i].handle) != PSA_SUCCESS)
+            status = PAL_ATTEST_ERR_KEY_FAIL;
+    }
+    attest_key_cache_next = 0;
+    attest_key_cache_read_only = 0;
+
+    return status;
+}
+
+/**
+    @brief    - Imports the attestation public key for every signing algorithm
+                ahead of concurrent verifications, which then only read the cache
+                until pal_crypto_pub_key_cache_invalidate(). To be called while
+                a single thread verifies.
+    @param    - void
+    @return   - error status
+**/
+uint32_t pal_crypto_pub_key_cache_load(void)
+{
+    uint32_t         status;
+    uint32_t         temporary;
+    uint32_t         i;
+    psa_key_handle_t key_handle;
 
-    public_key_registered = 0;
+    for (i = 0; i < sizeof(attest_sig_alg_ids)/sizeof(attest_sig_alg_ids[0]); i++)
+    {
+        status = pal_get_attest_key(key_alg_from_sig_alg_id(attest_sig_alg_ids[i]),
+                                    NULLUsefulBufC, &key_handle, &temporary);
+        if (status != PAL_ATTEST_SUCCESS)
+            return status;
+    }
+    attest_key_cache_read_only = 1;
 
     return PAL_ATTEST_SUCCESS;
 }
 
 uint32_t pal_crypto_pub_key_verify(int32_t cose_algorithm_id,
+                                   struct q_useful_buf_c kid,
                                    struct q_useful_buf_c token_hash,
                                    struct q_useful_buf_c signature)
 {
     int32_t status = PAL_ATTEST_ERROR;
-    psa_algorithm_t key_alg = PSA_ALG_ECDSA(PSA_ALG_SHA_256);
+    psa_algorithm_t key_alg = key_alg_from_sig_alg_id(cose_algorithm_id);
+    psa_key_handle_t key_handle;
+    uint32_t temporary;
 
-    (void)cose_algorithm_id;
-
-    /* Register the attestation public key */
-    status = pal_import_attest_key(key_alg);
+    /* Look up the attestation public key by the kid, imported on a miss only */
+    status = pal_get_attest_key(key_alg, kid, &key_handle, &temporary);
     if (status != PAL_ATTEST_SUCCESS)
         return status;
 
     /* Verify the signature */
-    status = psa_verify_hash(public_key_handle,
+    status = psa_verify_hash(key_handle,
                                    key_alg, token_hash.ptr, token_hash.len,
                                    signature.ptr, signature.len);
+    if (temporary)
+        psa_destroy_key(key_handle);
     if (status != PSA_SUCCESS)
         return PAL_ATTEST_ERR_SIGNATURE_FAIL;
 
-    /* Unregister the attestation public key */
-    status = pal_destroy_attest_key();
-    if (status != PSA_SUCCESS)
-        return PAL_ATTEST_ERR_KEY_FAIL;
-
     return PAL_ATTEST_SUCCESS;
 }
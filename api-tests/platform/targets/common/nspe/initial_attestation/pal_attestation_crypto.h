@@ -21,6 +21,41 @@
 #include "pal_attestation_eat.h"
 #include "psa/crypto.h"
 
+/* Number of attestation public keys kept imported across token verifications */
+#ifndef PAL_ATTEST_KEY_CACHE_SIZE
+#define PAL_ATTEST_KEY_CACHE_SIZE   4
+#endif
+
+/* Cached keys are identified by the SHA-256 of the public key, the kid of the tokens */
+#define PAL_ATTEST_KEY_ID_SIZE      32
+
+/* COSE algorithms beyond the ES256 of pal_attestation_config.h, RFC 8152 */
+#ifndef COSE_ALGORITHM_ES384
+#define COSE_ALGORITHM_ES384        -35
+#endif
+#ifndef COSE_ALGORITHM_ES512
+#define COSE_ALGORITHM_ES512        -36
+#endif
+#ifndef COSE_ALGORITHM_SHA_384
+#define COSE_ALGORITHM_SHA_384      -43
+#endif
+#ifndef COSE_ALGORITHM_SHA_512
+#define COSE_ALGORITHM_SHA_512      -44
+#endif
+
+/* Uncompressed public key of the largest supported curve, secp521r1 */
+#ifndef PAL_ATTEST_MAX_PUBLIC_KEY_SIZE
+#define PAL_ATTEST_MAX_PUBLIC_KEY_SIZE  (1 + 2 * PSA_BITS_TO_BYTES(521))
+#endif
+
+/* Largest CBOR head, initial byte and 8 bytes of argument */
+#define PAL_CBOR_HEAD_MAX_SIZE      9
+
+/* CBOR major types, in the top 3 bits of the initial byte */
+#define PAL_CBOR_MAJOR_BYTE_STRING  (2 << 5)
+#define PAL_CBOR_MAJOR_TEXT_STRING  (3 << 5)
+#define PAL_CBOR_MAJOR_ARRAY        (4 << 5)
+
 int32_t pal_cose_crypto_hash_start(psa_hash_operation_t *psa_hash, int32_t cose_hash_alg_id);
 void pal_cose_crypto_hash_update(psa_hash_operation_t *psa_hash,
                                  struct q_useful_buf_c data_to_hash);
@@ -32,6 +67,9 @@ int pal_create_sha256(struct q_useful_buf_c bytes_to_hash, struct q_useful_buf b
 uint32_t pal_compute_hash(int32_t cose_alg_id, struct q_useful_buf buffer_for_hash,
                           struct q_useful_buf_c *hash, struct q_useful_buf_c protected_headers,
                           struct q_useful_buf_c payload);
-uint32_t pal_crypto_pub_key_verify(int32_t cose_algorithm_id, struct q_useful_buf_c token_hash,
+uint32_t pal_crypto_pub_key_verify(int32_t cose_algorithm_id, struct q_useful_buf_c kid,
+                                   struct q_useful_buf_c token_hash,
                                    struct q_useful_buf_c signature);
+uint32_t pal_crypto_pub_key_cache_invalidate(void);
+uint32_t pal_crypto_pub_key_cache_load(void);
 #endif /* _PAL_ATTESTATION_CRYPTO_H_ */
@@ -21,6 +21,7 @@
 #include "qcbor.h"
 #include "pal_common.h"
 
+/* Also VAL_ATTEST_PAL_MIN_ERROR of val_attestation.h */
 #define PAL_ATTEST_MIN_ERROR              30
 
 enum attestation_error_code {
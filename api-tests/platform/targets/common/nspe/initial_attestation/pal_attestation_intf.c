@@ -30,7 +30,7 @@ int32_t pal_attestation_function(int type, va_list valist)
     size_t                  challenge_size, *token_size, token_buffer_size;
     int32_t                 cose_algorithm_id;
     struct q_useful_buf     buffer_for_hash;
-    struct q_useful_buf_c  *hash, payload, protected_headers, token_hash, signature;
+    struct q_useful_buf_c  *hash, payload, protected_headers, kid, token_hash, signature;
 
     switch (type)
     {
@@ -56,9 +56,14 @@ int32_t pal_attestation_function(int type, va_list valist)
                                     protected_headers, payload);
         case PAL_INITIAL_ATTEST_VERIFY_WITH_PK:
             cose_algorithm_id = va_arg(valist, int32_t);
+            kid = va_arg(valist, struct q_useful_buf_c);
             token_hash = va_arg(valist, struct q_useful_buf_c);
             signature = va_arg(valist, struct q_useful_buf_c);
-            return pal_crypto_pub_key_verify(cose_algorithm_id, token_hash, signature);
+            return pal_crypto_pub_key_verify(cose_algorithm_id, kid, token_hash, signature);
+        case PAL_INITIAL_ATTEST_KEY_CACHE_INVALIDATE:
+            return pal_crypto_pub_key_cache_invalidate();
+        case PAL_INITIAL_ATTEST_KEY_CACHE_LOAD:
+            return pal_crypto_pub_key_cache_load();
         default:
             return PAL_STATUS_UNSUPPORTED_FUNC;
     }
@@ -26,6 +26,8 @@ enum attestation_function_code {
     PAL_INITIAL_ATTEST_VERIFY_TOKEN     = 0x3,
     PAL_INITIAL_ATTEST_COMPUTE_HASH     = 0x4,
     PAL_INITIAL_ATTEST_VERIFY_WITH_PK   = 0x5,
+    PAL_INITIAL_ATTEST_KEY_CACHE_INVALIDATE = 0x6,
+    PAL_INITIAL_ATTEST_KEY_CACHE_LOAD   = 0x7,
 };
 
 int32_t pal_attestation_function(int type, va_list valist);
@@ -82,6 +82,23 @@ typedef enum {
     UART_PRINT            = 0x2,
 } uart_fn_type_t;
 
+/* Body of a thread started by pal_run_threads, thread_idx goes from 0 to num_threads-1 */
+typedef void (*thread_fn_t)(uint32_t thread_idx, void *arg);
+
+/* Body of a process started by pal_run_killable, it may be killed at any point */
+typedef void (*killable_fn_t)(void *arg);
+
+/* One case of the memory isolation matrix run by pal_isolation_probe */
+typedef struct {
+    const char *caller;
+    const char *owner;
+    const char *region;
+    uint32_t    write;
+    uint32_t    expect_fault;
+    uint32_t    faulted;
+    uint32_t    latency_ns;
+} isolation_case_t;
+
 /*
  * Redefining some of the client.h elements for compilation to go through
  * when PSA IPC APIs are not implemented.
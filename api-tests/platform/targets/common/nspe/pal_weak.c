@@ -32,6 +32,17 @@ __attribute__((weak)) bool_t pal_is_test_enabled(test_id_t test_id)
 	return 1;
 }
 
+/**
+ *   @brief    - Returns the spec version whose tests a spec version matrix build
+ *               runs. Platforms without a way to select it can leave this
+ *               unimplemented, the newest version of the build is then run.
+ *   @return   - Spec version, as given to -DSPEC_VERSION, or NULL
+**/
+__attribute__((weak)) char *pal_get_spec_version(void)
+{
+	return NULL;
+}
+
 /**
  *   @brief    - initialize anything relavent to a platform
  *               like any key initialization for crypto operations and etc
@@ -42,3 +53,74 @@ __attribute__((weak)) unsigned int pal_platform_init(void)
 {
 	return (unsigned int)PAL_STATUS_SUCCESS;
 }
+
+/**
+ *   @brief    - Reads a free running timestamp used by benchmark tests to
+ *               measure API latency. Platforms without a suitable timer
+ *               can leave this unimplemented.
+ *   @param    - timestamp : Returns the current time in nano seconds
+ *   @return   - SUCCESS/FAILURE
+**/
+__attribute__((weak)) int pal_get_timestamp_ns(uint64_t *timestamp)
+{
+	*timestamp = 0;
+
+	return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+/**
+ *   @brief    - Runs thread_fn concurrently on num_threads threads and waits for
+ *               all of them to return. Only needed by the concurrency stress tests,
+ *               platforms without threads can leave this unimplemented.
+ *   @param    - num_threads : Number of threads to run
+ *               thread_fn   : Thread body, called with the thread index and arg
+ *               arg         : Argument passed to every thread
+ *   @return   - SUCCESS/FAILURE
+**/
+__attribute__((weak)) int pal_run_threads(uint32_t num_threads, thread_fn_t thread_fn, void *arg)
+{
+	(void)num_threads;
+	(void)thread_fn;
+	(void)arg;
+
+	return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+/**
+ *   @brief    - Runs fn in a separate process and kills that process after
+ *               kill_delay_us micro seconds, as a power loss would. Only needed
+ *               by the crash consistency tests, platforms that cannot kill a
+ *               running client can leave this unimplemented.
+ *   @param    - fn            : Function to run, called with arg
+ *               arg           : Argument passed to fn
+ *               kill_delay_us : Delay before the kill, zero lets fn run to completion
+ *               completed     : Returns 1 if fn returned before the kill, 0 otherwise
+ *   @return   - SUCCESS/FAILURE
+**/
+__attribute__((weak)) int pal_run_killable(killable_fn_t fn, void *arg, uint32_t kill_delay_us,
+                                           uint32_t *completed)
+{
+	(void)fn;
+	(void)arg;
+	(void)kill_delay_us;
+	*completed = 0;
+
+	return PAL_STATUS_UNSUPPORTED_FUNC;
+}
+
+/**
+ *   @brief    - Runs one case of the memory isolation matrix, an access of a caller
+ *               to a memory region of an owner, catching the fault instead of
+ *               resetting. Only platforms able to recover from an isolation fault
+ *               implement it, the others rely on the reset based isolation tests.
+ *   @param    - index    : Case index, from 0
+ *               iso_case : Returns the case and its outcome
+ *   @return   - SUCCESS, PAL_STATUS_ERROR past the last case
+**/
+__attribute__((weak)) int pal_isolation_probe(uint32_t index, isolation_case_t *iso_case)
+{
+	(void)index;
+	(void)iso_case;
+
+	return PAL_STATUS_UNSUPPORTED_FUNC;
+}
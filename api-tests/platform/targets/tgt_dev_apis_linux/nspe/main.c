@@ -17,6 +17,10 @@
 
 #include <stdint.h>
 
+#ifdef IPC
+#include "spm_emul.h"
+#endif
+
 int32_t val_entry(void);
 
 /**
@@ -28,6 +32,12 @@ int32_t val_entry(void);
 int main(int argc, char **argv)
 {
     (void)argc;
+#ifdef IPC
+    /* Starts the secure partitions, this thread being the NSPE */
+    if (spm_emul_start(argv))
+        return 1;
+#else
     (void)argv;
+#endif
     return val_entry();
 }
@@ -16,15 +16,34 @@
  * limitations under the License.
 **/
 
+/* clock_gettime() and pthreads are POSIX, not part of the C99 library selected by -std=c99 */
+#define _POSIX_C_SOURCE 200112L
+
 #include <inttypes.h>
 #include <limits.h>
+#include <pthread.h>
+#include <signal.h>
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
 
 #include "pal_common.h"
 
+#ifdef IPC
+#include "spm_emul.h"
+#endif
+
+#ifndef IPC
+/* With the IPC suite, the UART, NVMEM and watchdog are services of the driver
+ * partition, reached through pal_driver_ipc_intf.c
+ */
+
 /* This stdc implementation doesn't support tests that involve resets of the
  * test process or the system, so we don't actually need non-volatile memory.
  * Just implement the "nvmem" as an array in memory.
@@ -38,6 +57,7 @@
 
 #define NVMEM_SIZE (1024)
 static uint8_t g_nvmem[NVMEM_SIZE];
+#endif
 
 /* The custom test list is a buffer in which all enabled test names are concatenated.
  * The test name template is <TEST_NAME_PREFIX><id><TEST_NAME_SUFFIX>, where <id>
@@ -48,6 +68,7 @@ static uint8_t g_nvmem[NVMEM_SIZE];
 
 char *g_custom_test_list = NULL;
 
+#ifndef IPC
 /**
     @brief    - Check that an nvmem access is within the bounds of the nvmem
     @param    - base    : Base address of nvmem (must be zero)
@@ -185,6 +206,7 @@ int pal_wd_timer_disable_ns(addr_t base_addr)
     (void)base_addr;
     return PAL_STATUS_SUCCESS;
 }
+#endif /* IPC */
 
 /**
      @brief    - Terminates the simulation at the end of all tests completion.
@@ -236,3 +258,221 @@ bool_t pal_is_test_enabled(test_id_t test_id)
 
     return strstr(g_custom_test_list, test_id_str)?1:0;
 }
+
+/**
+ *   @brief    - Returns the spec version whose tests a spec version matrix build
+ *               runs, read from the PSA_SPEC_VERSION environment variable
+ *   @return   - Spec version, as given to -DSPEC_VERSION, or NULL for the newest one
+**/
+char *pal_get_spec_version(void)
+{
+    return getenv("PSA_SPEC_VERSION");
+}
+
+/**
+ *   @brief    - Reads a free running timestamp used by benchmark tests
+ *
+ *   This implementation reads CLOCK_MONOTONIC so that the measurements are
+ *   not disturbed by wall clock adjustments.
+ *
+ *   @param    - timestamp : Returns the current time in nano seconds
+ *   @return   - SUCCESS/FAILURE
+**/
+int pal_get_timestamp_ns(uint64_t *timestamp)
+{
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+    {
+        return PAL_STATUS_ERROR;
+    }
+    *timestamp = ((uint64_t)ts.tv_sec * 1000000000u) + (uint64_t)ts.tv_nsec;
+    return PAL_STATUS_SUCCESS;
+}
+
+/* Shared state of one pal_run_threads() invocation. The start gate holds every
+ * thread back until all of them have been created, so that the threads contend
+ * for the whole run instead of the first ones finishing before the last start.
+ */
+typedef struct {
+    thread_fn_t     thread_fn;
+    void           *arg;
+    pthread_mutex_t lock;
+    pthread_cond_t  start_cond;
+    int             start;
+} thread_group_t;
+
+typedef struct {
+    thread_group_t *group;
+    uint32_t        thread_idx;
+} thread_ctx_t;
+
+static void *thread_entry(void *param)
+{
+    thread_ctx_t   *ctx = (thread_ctx_t *)param;
+    thread_group_t *group = ctx->group;
+
+    pthread_mutex_lock(&group->lock);
+    while (!group->start)
+        pthread_cond_wait(&group->start_cond, &group->lock);
+    pthread_mutex_unlock(&group->lock);
+
+    group->thread_fn(ctx->thread_idx, group->arg);
+    return NULL;
+}
+
+/**
+ *   @brief    - Runs thread_fn concurrently on num_threads threads and waits for
+ *               all of them to return
+ *
+ *   This implementation uses POSIX threads, the final executable needs to be
+ *   linked with -lpthread.
+ *
+ *   @param    - num_threads : Number of threads to run
+ *               thread_fn   : Thread body, called with the thread index and arg
+ *               arg         : Argument passed to every thread
+ *   @return   - SUCCESS/FAILURE
+**/
+int pal_run_threads(uint32_t num_threads, thread_fn_t thread_fn, void *arg)
+{
+    thread_group_t group;
+    thread_ctx_t  *ctx;
+    pthread_t     *tid;
+    uint32_t       created;
+    int            status = PAL_STATUS_SUCCESS;
+
+    if ((num_threads == 0) || (thread_fn == NULL))
+        return PAL_STATUS_ERROR;
+
+    ctx = calloc(num_threads, sizeof(*ctx));
+    tid = calloc(num_threads, sizeof(*tid));
+    if ((ctx == NULL) || (tid == NULL))
+    {
+        free(ctx);
+        free(tid);
+        return PAL_STATUS_ERROR;
+    }
+
+    group.thread_fn = thread_fn;
+    group.arg       = arg;
+    group.start     = 0;
+    pthread_mutex_init(&group.lock, NULL);
+    pthread_cond_init(&group.start_cond, NULL);
+
+    for (created = 0; created < num_threads; created++)
+    {
+        ctx[created].group      = &group;
+        ctx[created].thread_idx = created;
+        if (pthread_create(&tid[created], NULL, thread_entry, &ctx[created]) != 0)
+        {
+            status = PAL_STATUS_ERROR;
+            break;
+        }
+    }
+
+    /* Release the threads even on a partial creation so that they can be joined */
+    pthread_mutex_lock(&group.lock);
+    group.start = 1;
+    pthread_cond_broadcast(&group.start_cond);
+    pthread_mutex_unlock(&group.lock);
+
+    while (created > 0)
+        pthread_join(tid[--created], NULL);
+
+    pthread_cond_destroy(&group.start_cond);
+    pthread_mutex_destroy(&group.lock);
+    free(ctx);
+    free(tid);
+    return status;
+}
+
+/**
+ *   @brief    - Runs fn in a separate process and kills that process after
+ *               kill_delay_us micro seconds, as a power loss would
+ *
+ *   This implementation forks the test process and sends SIGKILL to the child.
+ *   What fn leaves behind is only visible to the caller when the storage
+ *   backend persists its data outside of the process, e.g. in files.
+ *
+ *   @param    - fn            : Function to run, called with arg
+ *               arg           : Argument passed to fn
+ *               kill_delay_us : Delay before the kill, zero lets fn run to completion
+ *               completed     : Returns 1 if fn returned before the kill, 0 otherwise
+ *   @return   - SUCCESS/FAILURE
+**/
+int pal_run_killable(killable_fn_t fn, void *arg, uint32_t kill_delay_us, uint32_t *completed)
+{
+    struct timespec delay;
+    pid_t           pid;
+    int             wstatus;
+
+    *completed = 0;
+    if (fn == NULL)
+        return PAL_STATUS_ERROR;
+
+    /* Pending test output would otherwise be printed by both processes */
+    fflush(stdout);
+
+    pid = fork();
+    if (pid < 0)
+        return PAL_STATUS_ERROR;
+    if (pid == 0)
+    {
+        fn(arg);
+        _exit(0);
+    }
+
+    if (kill_delay_us)
+    {
+        delay.tv_sec  = kill_delay_us / 1000000u;
+        delay.tv_nsec = (long)(kill_delay_us % 1000000u) * 1000;
+        nanosleep(&delay, NULL);
+        kill(pid, SIGKILL);
+    }
+
+    if (waitpid(pid, &wstatus, 0) != pid)
+        return PAL_STATUS_ERROR;
+
+    if (WIFEXITED(wstatus))
+    {
+        if (WEXITSTATUS(wstatus) != 0)
+            return PAL_STATUS_ERROR;
+        *completed = 1;
+    }
+    return PAL_STATUS_SUCCESS;
+}
+
+#ifdef IPC
+/**
+ *   @brief    - Runs one case of the memory isolation matrix
+ *
+ *   This implementation runs the case in the host SPM emulation, which isolates
+ *   the partitions with memory protection keys and catches the fault with a
+ *   signal handler.
+ *
+ *   @param    - index    : Case index, from 0
+ *               iso_case : Returns the case and its outcome
+ *   @return   - SUCCESS, PAL_STATUS_ERROR past the last case
+**/
+int pal_isolation_probe(uint32_t index, isolation_case_t *iso_case)
+{
+    spm_emul_isolation_case_t spm_case;
+    int                       status;
+
+    status = spm_emul_isolation_probe(index, &spm_case);
+    if (status < 0)
+        return PAL_STATUS_UNSUPPORTED_FUNC;
+    if (status > 0)
+        return PAL_STATUS_ERROR;
+
+    iso_case->caller       = spm_case.caller;
+    iso_case->owner        = spm_case.owner;
+    iso_case->region       = spm_case.region;
+    iso_case->write        = spm_case.write;
+    iso_case->expect_fault = spm_case.expect_fault;
+    iso_case->faulted      = spm_case.faulted;
+    iso_case->latency_ns   = (spm_case.elapsed_ns > UINT32_MAX) ? UINT32_MAX :
+                             (uint32_t)spm_case.elapsed_ns;
+    return PAL_STATUS_SUCCESS;
+}
+#endif
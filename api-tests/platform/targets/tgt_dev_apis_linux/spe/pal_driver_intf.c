@@ -0,0 +1,166 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "pal_interfaces_s.h"
+#include "spm_emul.h"
+
+/* Zero is the NVMEM base of target.cfg, the NVMEM itself is kept by the SPM
+ * emulation across resets
+ */
+#define NVMEM_BASE 0
+
+static uint32_t g_wd_timeout_us;
+
+static int nvmem_check_bounds(addr_t base, uint32_t offset, int size)
+{
+    if ((base != NVMEM_BASE) || (size < 0) || (offset > SPM_EMUL_NVMEM_SIZE) ||
+        ((uint32_t)size > SPM_EMUL_NVMEM_SIZE - offset))
+        return 0;
+
+    return 1;
+}
+
+/**
+    @brief    - This function initializes the UART
+
+    The driver partition prints to stdout, no init necessary.
+
+    @param    - uart base addr (ignored)
+**/
+void pal_uart_init(addr_t uart_base_addr)
+{
+    (void)uart_base_addr;
+}
+
+/**
+    @brief    - This function parses the input string and writes bytes into UART TX FIFO
+    @param    - str      : Input String
+              - data     : Value for format specifier
+**/
+void pal_print(const char *str, int32_t data)
+{
+    printf(str, data);
+    fflush(stdout);
+}
+
+/**
+    @brief    - Writes into given non-volatile address.
+    @param    - base    : Base address of nvmem
+                offset  : Offset
+                buffer  : Pointer to source address
+                size    : Number of bytes
+    @return   - 1/0
+**/
+int pal_nvmem_write(addr_t base, uint32_t offset, void *buffer, int size)
+{
+    if (!nvmem_check_bounds(base, offset, size))
+        return 0;
+
+    memcpy(spm_emul_nvmem() + offset, buffer, (size_t)size);
+    return 1;
+}
+
+/**
+    @brief    - Reads from given non-volatile address.
+    @param    - base    : Base address of nvmem
+                offset  : Offset
+                buffer  : Pointer to source address
+                size    : Number of bytes
+    @return   - 1/0
+**/
+int pal_nvmem_read(addr_t base, uint32_t offset, void *buffer, int size)
+{
+    if (!nvmem_check_bounds(base, offset, size))
+        return 0;
+
+    memcpy(buffer, spm_emul_nvmem() + offset, (size_t)size);
+    return 1;
+}
+
+/**
+    @brief           - Initializes the watchdog timer of the SPM emulation
+    @param           - base_addr       : Base address of the watchdog module (ignored)
+                     - time_us         : Time in micro seconds
+                     - timer_tick_us   : Number of ticks per micro second (ignored)
+    @return          - SUCCESS/FAILURE
+**/
+int pal_wd_timer_init(addr_t base_addr, uint32_t time_us, uint32_t timer_tick_us)
+{
+    (void)base_addr;
+    (void)timer_tick_us;
+    g_wd_timeout_us = time_us;
+    return 0;
+}
+
+/**
+    @brief           - Enables the watchdog timer, which resets the emulated system on expiry
+    @param           - base_addr       : Base address of the watchdog module (ignored)
+    @return          - SUCCESS/FAILURE
+**/
+int pal_wd_timer_enable(addr_t base_addr)
+{
+    (void)base_addr;
+    spm_emul_watchdog_start(g_wd_timeout_us);
+    return 0;
+}
+
+/**
+    @brief           - Disables the watchdog timer
+    @param           - base_addr       : Base address of the watchdog module (ignored)
+    @return          - SUCCESS/FAILURE
+**/
+int pal_wd_timer_disable(addr_t base_addr)
+{
+    (void)base_addr;
+    spm_emul_watchdog_stop();
+    return 0;
+}
+
+/**
+    @brief           - Checks whether the watchdog timer is enabled
+    @param           - base_addr       : Base address of the watchdog module (ignored)
+    @return          - Enabled : 1, Disabled : 0
+**/
+int pal_wd_timer_is_enabled(addr_t base_addr)
+{
+    (void)base_addr;
+    return spm_emul_watchdog_is_running();
+}
+
+/**
+    @brief   - Trigger interrupt for irq signal assigned to driver partition
+               before return to caller.
+    @param   - void
+    @return  - void
+**/
+void pal_generate_interrupt(void)
+{
+    spm_emul_irq_set_level(SPM_EMUL_IRQ_FF_TEST_UART_IRQ, 1);
+}
+
+/**
+    @brief   - Disable interrupt that was generated using pal_generate_interrupt API.
+    @param   - void
+    @return  - void
+**/
+void pal_disable_interrupt(void)
+{
+    spm_emul_irq_set_level(SPM_EMUL_IRQ_FF_TEST_UART_IRQ, 0);
+}
@@ -0,0 +1,80 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+/* PSA-FF client API implemented by the linux host SPM emulation */
+
+#ifndef __PSA_CLIENT_H__
+#define __PSA_CLIENT_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if SPEC_VERSION == 11
+#define PSA_FRAMEWORK_VERSION           (0x0101u)
+#else
+#define PSA_FRAMEWORK_VERSION           (0x0100u)
+#endif
+
+#define PSA_VERSION_NONE                (0u)
+
+#define PSA_SUCCESS                     ((psa_status_t)0)
+#define PSA_ERROR_PROGRAMMER_ERROR      ((psa_status_t)-129)
+#define PSA_ERROR_CONNECTION_REFUSED    ((psa_status_t)-130)
+#define PSA_ERROR_CONNECTION_BUSY       ((psa_status_t)-131)
+
+#define PSA_NULL_HANDLE                 ((psa_handle_t)0)
+#define PSA_HANDLE_IS_VALID(handle)     ((psa_handle_t)(handle) > 0)
+#define PSA_HANDLE_TO_ERROR(handle)     ((psa_status_t)(handle))
+
+#define PSA_MAX_IOVEC                   (4u)
+
+#define PSA_IPC_CALL                    (0)
+
+#ifndef __PSA_STATUS_T__
+#define __PSA_STATUS_T__
+typedef int32_t psa_status_t;
+#endif
+
+typedef int32_t psa_handle_t;
+
+typedef struct psa_invec {
+    const void *base;
+    size_t      len;
+} psa_invec;
+
+typedef struct psa_outvec {
+    void       *base;
+    size_t      len;
+} psa_outvec;
+
+uint32_t     psa_framework_version(void);
+uint32_t     psa_version(uint32_t sid);
+psa_handle_t psa_connect(uint32_t sid, uint32_t version);
+psa_status_t psa_call(psa_handle_t handle, int32_t type,
+                      const psa_invec *in_vec, size_t in_len,
+                      psa_outvec *out_vec, size_t out_len);
+void         psa_close(psa_handle_t handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PSA_CLIENT_H__ */
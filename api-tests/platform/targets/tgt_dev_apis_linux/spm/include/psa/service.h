@@ -0,0 +1,72 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+/* PSA-FF secure partition API implemented by the linux host SPM emulation */
+
+#ifndef __PSA_SERVICE_H__
+#define __PSA_SERVICE_H__
+
+#include "psa/client.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define PSA_WAIT_ANY                    (0xFFFFFFFFu)
+#define PSA_POLL                        (0x00000000u)
+#define PSA_BLOCK                       (0x80000000u)
+
+#define PSA_DOORBELL                    (0x00000008u)
+
+#define PSA_IPC_CONNECT                 (-1)
+#define PSA_IPC_DISCONNECT              (-2)
+
+#define PSA_MAX_IOVEC_SIZE              PSA_MAX_IOVEC
+
+typedef uint32_t psa_signal_t;
+typedef uint32_t psa_irq_status_t;
+
+typedef struct psa_msg_t {
+    int32_t         type;
+    psa_handle_t    handle;
+    int32_t         client_id;
+    void           *rhandle;
+    size_t          in_size[PSA_MAX_IOVEC];
+    size_t          out_size[PSA_MAX_IOVEC];
+} psa_msg_t;
+
+psa_signal_t     psa_wait(psa_signal_t signal_mask, uint32_t timeout);
+psa_status_t     psa_get(psa_signal_t signal, psa_msg_t *msg);
+void             psa_set_rhandle(psa_handle_t msg_handle, void *rhandle);
+size_t           psa_read(psa_handle_t msg_handle, uint32_t invec_idx,
+                          void *buffer, size_t num_bytes);
+size_t           psa_skip(psa_handle_t msg_handle, uint32_t invec_idx, size_t num_bytes);
+void             psa_write(psa_handle_t msg_handle, uint32_t outvec_idx,
+                           const void *buffer, size_t num_bytes);
+void             psa_reply(psa_handle_t msg_handle, psa_status_t status);
+void             psa_notify(int32_t partition_id);
+void             psa_clear(void);
+void             psa_eoi(psa_signal_t irq_signal);
+void             psa_irq_enable(psa_signal_t irq_signal);
+psa_irq_status_t psa_irq_disable(psa_signal_t irq_signal);
+void             psa_panic(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __PSA_SERVICE_H__ */
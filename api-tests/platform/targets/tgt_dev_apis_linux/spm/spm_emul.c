@@ -0,0 +1,1617 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+/*
+ * Host emulation of the PSA-FF IPC model for the linux target.
+ *
+ * Every secure partition of platform/manifests runs its entry point in a thread
+ * of its own and the thread calling spm_emul_start() is the NSPE. The client
+ * and secure partition APIs exchange messages through per RoT Service queues
+ * under a single lock, each partition sleeping on its own condition variable
+ * in psa_wait() and each client on its message until psa_reply().
+ *
+ * A PROGRAMMER ERROR returns the error to the NSPE and panics a secure caller.
+ * A panic, psa_panic() and the watchdog reset the emulated system. The process
+ * is checkpointed at power-on, before any partition runs, by forking it: the
+ * running system is the child and a reset ends it, the checkpoint forking a
+ * new one in the power-on state. The NVMEM is a shared mapping kept across
+ * resets, so the boot state machine of the dispatcher runs as on a device.
+ * Without the checkpoint, a reset restarts the process image, the NVMEM being
+ * kept in a memfd inherited by the new image.
+ *
+ * Partitions run on stacks of their own. When the host has memory protection
+ * keys, each partition gets a key tagging its stack and MMIO regions, and every
+ * thread restricts its access rights to the keys its isolation level allows.
+ */
+
+#define _GNU_SOURCE
+
+#include <errno.h>
+#include <pthread.h>
+#include <setjmp.h>
+#include <signal.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <ucontext.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+
+#include "psa/client.h"
+#include "psa/service.h"
+#include "psa/lifecycle.h"
+#include "val_target.h"
+#include "spm_emul.h"
+
+#ifndef MAP_FIXED_NOREPLACE
+#define MAP_FIXED_NOREPLACE         0
+#endif
+
+/* Connections open at the same time over all the RoT Services */
+#ifndef SPM_MAX_CONNECTIONS
+#define SPM_MAX_CONNECTIONS         32
+#endif
+
+/* Messages in flight at the same time */
+#ifndef SPM_MAX_MESSAGES
+#define SPM_MAX_MESSAGES            32
+#endif
+
+#define SPM_MAX_REGIONS             16
+#define SPM_MAX_RO_MAPPINGS         64
+#define SPM_NVMEM_FD_ENV            "PSA_SPM_EMUL_NVMEM_FD"
+
+/* Resets restore the power-on checkpoint instead of restarting the process */
+#ifndef SPM_EMUL_CHECKPOINT
+#define SPM_EMUL_CHECKPOINT         1
+#endif
+
+/* Stack of each partition, and of its fault handler */
+#ifndef SPM_PARTITION_STACK_SIZE
+#define SPM_PARTITION_STACK_SIZE    0x40000
+#endif
+#define SPM_ALTSTACK_SIZE           0x10000
+
+/* Written by the write accesses of the isolation matrix */
+#define SPM_ISOLATION_PATTERN       0x5A5A5A5Au
+
+/* Handles encode the slot index and a generation so that stale handles are
+ * told apart from the current user of the slot
+ */
+#define SPM_HANDLE_GEN_MASK         0xFFFu
+#define SPM_HANDLE_IDX_MASK         0xFFFFu
+#define SPM_MSG_HANDLE_FLAG         0x10000000u
+#define SPM_HANDLE(flag, idx, gen)  ((psa_handle_t)((flag) | (((gen) & SPM_HANDLE_GEN_MASK) << 16) \
+                                                    | ((uint32_t)(idx) + 1)))
+#define SPM_HANDLE_IDX(handle)      ((((uint32_t)(handle)) & SPM_HANDLE_IDX_MASK) - 1)
+#define SPM_HANDLE_GEN(handle)      ((((uint32_t)(handle)) >> 16) & SPM_HANDLE_GEN_MASK)
+
+#define SPM_NSPE                    (-1)
+#define SPM_NSPE_CLIENT_ID          (-1)
+/* Memory domain of the SPM, which accesses the memory of every partition */
+#define SPM_DOMAIN_ALL              (-2)
+
+typedef struct {
+    const char          *name;
+    int32_t              id;
+    uint32_t             psa_rot;
+    void               (*entry)(void);
+    const uint32_t      *dependencies;
+    uint32_t             num_dependencies;
+    const char *const   *mmio_regions;
+    uint32_t             num_mmio_regions;
+} spm_partition_t;
+
+typedef struct {
+    const char          *name;
+    uint32_t             sid;
+    uint32_t             version;
+    uint32_t             strict_version;
+    psa_signal_t         signal;
+    uint32_t             partition;
+    uint32_t             non_secure_clients;
+    uint32_t             connection_based;
+    uint32_t             stateless_handle;
+} spm_service_t;
+
+typedef struct {
+    psa_signal_t         signal;
+    uint32_t             source;
+    int32_t              partition;
+} spm_irq_t;
+
+#include "spm_emul_manifest.inc"
+
+typedef enum {
+    SPM_CONN_FREE = 0,
+    SPM_CONN_CONNECTING,
+    SPM_CONN_ACTIVE,
+    SPM_CONN_DROPPED,
+} spm_conn_state_t;
+
+typedef struct {
+    spm_conn_state_t     state;
+    uint32_t             gen;
+    int32_t              owner;
+    uint32_t             service;
+    void                *rhandle;
+} spm_conn_t;
+
+typedef struct spm_msg {
+    uint32_t             in_use;
+    uint32_t             gen;
+    uint32_t             fetched;
+    int32_t              type;
+    uint32_t             service;
+    int32_t              owner;
+    spm_conn_t          *conn;
+    void                *rhandle;
+    psa_invec            in_vec[PSA_MAX_IOVEC];
+    psa_outvec           out_vec[PSA_MAX_IOVEC];
+    size_t               in_pos[PSA_MAX_IOVEC];
+    size_t               out_pos[PSA_MAX_IOVEC];
+    uint32_t             waiter;
+    uint32_t             replied;
+    psa_status_t         status;
+    pthread_cond_t       replied_cond;
+    struct spm_msg      *next;
+} spm_msg_t;
+
+typedef struct {
+    spm_msg_t           *head;
+    spm_msg_t           *tail;
+} spm_queue_t;
+
+typedef struct {
+    pthread_t            thread;
+    pthread_cond_t       cond;
+    psa_signal_t         asserted;
+} spm_partition_state_t;
+
+typedef struct {
+    uint32_t             enabled;
+    uint32_t             level;
+} spm_irq_state_t;
+
+typedef struct {
+    const char          *name;
+    memory_cfg_id_t      cfg_id;
+} spm_mmio_name_t;
+
+typedef struct {
+    const char          *name;
+    uintptr_t            start;
+    uintptr_t            end;
+    int32_t              owner;
+    uintptr_t            probe;
+    uint32_t             isolated;
+} spm_region_t;
+
+static pthread_mutex_t       spm_lock = PTHREAD_MUTEX_INITIALIZER;
+static spm_partition_state_t spm_partition_state[SPM_NUM_PARTITIONS];
+static spm_queue_t           spm_queues[SPM_NUM_SERVICES];
+static spm_conn_t            spm_conns[SPM_MAX_CONNECTIONS];
+static spm_msg_t             spm_msgs[SPM_MAX_MESSAGES];
+static spm_irq_state_t       spm_irq_state[SPM_NUM_IRQS + 1];
+static uint32_t              spm_gen;
+
+/* Partition index of the calling thread, SPM_NSPE for the NSPE */
+static __thread int32_t      spm_caller = SPM_NSPE;
+
+static char                **spm_argv;
+static uint8_t              *spm_nvmem;
+
+/* Shared with the checkpoint, set by a reset of the running system */
+static volatile uint32_t    *spm_reset_request;
+
+/* Emulated memory regions of target.cfg, owned by the partitions listing them
+ * in their manifest and by the NSPE otherwise
+ */
+static const spm_mmio_name_t spm_mmio_names[] = {
+    {"FF_TEST_NVMEM_REGION",            MEMORY_NVMEM},
+    {"FF_TEST_NSPE_MMIO",               MEMORY_NSPE_MMIO},
+    {"FF_TEST_SERVER_PARTITION_MMIO",   MEMORY_SERVER_PARTITION_MMIO},
+    {"FF_TEST_DRIVER_PARTITION_MMIO",   MEMORY_DRIVER_PARTITION_MMIO},
+};
+static spm_region_t          spm_regions[SPM_MAX_REGIONS];
+static uint32_t              spm_num_regions;
+
+/* Protection key of each partition, valid when spm_isolation is set */
+static int                   spm_pkeys[SPM_NUM_PARTITIONS];
+static uint32_t              spm_isolation;
+
+/* Set while the calling thread runs a case of the isolation matrix */
+static __thread sigjmp_buf  *spm_probe_env;
+
+/* Read-only mappings of the process (code and constant data), which are not
+ * valid psa_outvec buffers
+ */
+static spm_region_t          spm_ro_mappings[SPM_MAX_RO_MAPPINGS];
+static uint32_t              spm_num_ro_mappings;
+
+static pthread_mutex_t       spm_wd_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t        spm_wd_cond;
+static struct timespec       spm_wd_deadline;
+static int                   spm_wd_running;
+
+/**
+    @brief    - Panics the calling partition, which resets the system
+    @param    - api : API in which the PROGRAMMER ERROR was detected
+**/
+static void spm_panic(const char *api)
+{
+    char reason[128];
+
+    snprintf(reason, sizeof(reason), "%s panic in %s",
+             (spm_caller == SPM_NSPE) ? "NSPE" : spm_partitions[spm_caller].name, api);
+    spm_emul_reset(reason);
+}
+
+/**
+    @brief    - Memory and instruction faults of the NSPE or a partition reset
+                the system, as a fault of the isolation hardware would
+    @param    - sig : Fault signal
+**/
+static void spm_fault(int sig)
+{
+    char reason[128];
+
+    if (spm_probe_env != NULL)
+        siglongjmp(*spm_probe_env, sig);
+
+    snprintf(reason, sizeof(reason), "%s %s fault",
+             (spm_caller == SPM_NSPE) ? "NSPE" : spm_partitions[spm_caller].name,
+             (sig == SIGILL) ? "instruction" : "memory");
+    spm_emul_reset(reason);
+}
+
+/**
+    @brief    - PROGRAMMER ERROR of a client API, returned to the NSPE
+    @param    - api    : API in which the error was detected
+                status : Status returned to the NSPE
+    @return   - status
+**/
+static psa_status_t spm_client_error(const char *api, psa_status_t status)
+{
+    if (spm_caller != SPM_NSPE)
+        spm_panic(api);
+
+    return status;
+}
+
+/**
+    @brief    - Isolation rules of the PSA isolation levels
+    @param    - caller : Partition index, SPM_NSPE or SPM_DOMAIN_ALL
+                owner  : Partition index or SPM_NSPE owning the memory
+    @return   - 1 if the caller may access the memory of the owner
+**/
+static int spm_domain_access_ok(int32_t caller, int32_t owner)
+{
+    if ((owner == caller) || (caller == SPM_DOMAIN_ALL))
+        return 1;
+    if (owner == SPM_NSPE)
+        return 1;
+    if (caller == SPM_NSPE)
+        return 0;
+
+    /* Secure partition accessing the memory of another partition */
+    if (PLATFORM_PSA_ISOLATION_LEVEL > 2)
+        return 0;
+    if ((PLATFORM_PSA_ISOLATION_LEVEL == 2) &&
+        spm_partitions[owner].psa_rot && !spm_partitions[caller].psa_rot)
+        return 0;
+
+    return 1;
+}
+
+/**
+    @brief    - Restricts the calling thread to the memory of a domain
+    @param    - domain : Partition index, SPM_NSPE or SPM_DOMAIN_ALL
+**/
+static void spm_isolation_enter(int32_t domain)
+{
+    uint32_t p;
+
+    if (!spm_isolation)
+        return;
+
+    for (p = 0; p < SPM_NUM_PARTITIONS; p++)
+        pkey_set(spm_pkeys[p], spm_domain_access_ok(domain, (int32_t)p) ? 0 : PKEY_DISABLE_ACCESS);
+}
+
+/**
+    @brief    - Copies a buffer of a psa_read() or psa_write(), the SPM accessing
+                the memory of the client on behalf of the partition
+    @param    - dst : Destination
+                src : Source
+                len : Number of bytes
+**/
+static void spm_copy(void *dst, const void *src, size_t len)
+{
+    spm_isolation_enter(SPM_DOMAIN_ALL);
+    memcpy(dst, src, len);
+    spm_isolation_enter(spm_caller);
+}
+
+/**
+    @brief    - Tags the pages of a region with the protection key of its owner.
+                Regions of the NSPE are accessible to every domain and keep the
+                default key.
+    @param    - region : Region, which must not share a page with another owner
+**/
+static void spm_region_protect(spm_region_t *region)
+{
+    uintptr_t page = (uintptr_t)sysconf(_SC_PAGESIZE);
+    uintptr_t start = region->start & ~(page - 1);
+    uintptr_t end = (region->end + page) & ~(page - 1);
+
+    if (!spm_isolation || (region->owner == SPM_NSPE))
+    {
+        region->isolated = spm_isolation;
+        return;
+    }
+
+    region->isolated = !pkey_mprotect((void *)start, end - start, PROT_READ | PROT_WRITE,
+                                      spm_pkeys[region->owner]);
+}
+
+/**
+    @brief    - Checks that the caller may access a buffer given to the SPM
+    @param    - caller : Partition index or SPM_NSPE
+                base   : Buffer
+                len    : Buffer size
+    @return   - 1 if the access is allowed
+**/
+static int spm_access_ok(int32_t caller, const void *base, size_t len)
+{
+    uintptr_t start = (uintptr_t)base, end;
+    uint32_t  i;
+
+    if (len == 0)
+        return 1;
+
+    end = start + len - 1;
+    if ((base == NULL) || (end < start))
+        return 0;
+
+    for (i = 0; i < spm_num_regions; i++)
+    {
+        if ((end < spm_regions[i].start) || (start > spm_regions[i].end))
+            continue;
+
+        if (!spm_domain_access_ok(caller, spm_regions[i].owner))
+            return 0;
+    }
+
+    return 1;
+}
+
+/**
+    @brief    - Checks that a buffer given to the SPM for output is writable
+    @param    - base : Buffer
+                len  : Buffer size
+    @return   - 1 if the buffer is writable
+**/
+static int spm_writable_ok(const void *base, size_t len)
+{
+    uintptr_t start = (uintptr_t)base, end = start + len - 1;
+    uint32_t  i;
+
+    if (len == 0)
+        return 1;
+
+    for (i = 0; i < spm_num_ro_mappings; i++)
+    {
+        if ((end >= spm_ro_mappings[i].start) && (start <= spm_ro_mappings[i].end))
+            return 0;
+    }
+
+    return 1;
+}
+
+static psa_signal_t spm_signals(uint32_t partition)
+{
+    psa_signal_t signals = spm_partition_state[partition].asserted;
+    uint32_t     i;
+
+    for (i = 0; i < SPM_NUM_SERVICES; i++)
+    {
+        if ((spm_services[i].partition == partition) && (spm_queues[i].head != NULL))
+            signals |= spm_services[i].signal;
+    }
+
+    return signals;
+}
+
+static psa_signal_t spm_valid_signals(uint32_t partition)
+{
+    psa_signal_t signals = PSA_DOORBELL;
+    uint32_t     i;
+
+    for (i = 0; i < SPM_NUM_SERVICES; i++)
+    {
+        if (spm_services[i].partition == partition)
+            signals |= spm_services[i].signal;
+    }
+    for (i = 0; i < SPM_NUM_IRQS; i++)
+    {
+        if (spm_irqs[i].partition == (int32_t)partition)
+            signals |= spm_irqs[i].signal;
+    }
+
+    return signals;
+}
+
+static uint32_t spm_next_gen(void)
+{
+    spm_gen = (spm_gen % SPM_HANDLE_GEN_MASK) + 1;
+    return spm_gen;
+}
+
+static int32_t spm_find_service(uint32_t sid)
+{
+    uint32_t i;
+
+    for (i = 0; i < SPM_NUM_SERVICES; i++)
+    {
+        if (spm_services[i].sid == sid)
+            return (int32_t)i;
+    }
+
+    return -1;
+}
+
+/**
+    @brief    - Checks the manifest access rights of the caller to a RoT Service
+    @param    - service : Service index
+    @return   - 1 if the caller may use the service
+**/
+static int spm_service_allowed(uint32_t service)
+{
+    const spm_partition_t *partition;
+    uint32_t               i;
+
+    if (spm_caller == SPM_NSPE)
+        return spm_services[service].non_secure_clients;
+
+    partition = &spm_partitions[spm_caller];
+    for (i = 0; i < partition->num_dependencies; i++)
+    {
+        if (partition->dependencies[i] == service)
+            return 1;
+    }
+
+    return 0;
+}
+
+static spm_conn_t *spm_find_conn(psa_handle_t handle)
+{
+    uint32_t    idx = SPM_HANDLE_IDX(handle);
+    spm_conn_t *conn;
+
+    if ((handle <= 0) || ((uint32_t)handle & ~(SPM_HANDLE_IDX_MASK | (SPM_HANDLE_GEN_MASK << 16))) ||
+        (idx >= SPM_MAX_CONNECTIONS))
+        return NULL;
+
+    conn = &spm_conns[idx];
+    if ((conn->state == SPM_CONN_FREE) || (conn->gen != SPM_HANDLE_GEN(handle)) ||
+        (conn->owner != spm_caller))
+        return NULL;
+
+    return conn;
+}
+
+static psa_handle_t spm_conn_handle(spm_conn_t *conn)
+{
+    return SPM_HANDLE(0, conn - spm_conns, conn->gen);
+}
+
+static spm_msg_t *spm_msg_alloc(int32_t type, uint32_t service, spm_conn_t *conn)
+{
+    spm_msg_t *msg;
+    uint32_t   i;
+
+    for (i = 0; i < SPM_MAX_MESSAGES; i++)
+    {
+        msg = &spm_msgs[i];
+        if (msg->in_use)
+            continue;
+
+        msg->in_use = 1;
+        msg->gen = spm_next_gen();
+        msg->fetched = 0;
+        msg->type = type;
+        msg->service = service;
+        msg->owner = spm_caller;
+        msg->conn = conn;
+        msg->rhandle = conn ? conn->rhandle : NULL;
+        memset(msg->in_vec, 0, sizeof(msg->in_vec));
+        memset(msg->out_vec, 0, sizeof(msg->out_vec));
+        memset(msg->in_pos, 0, sizeof(msg->in_pos));
+        memset(msg->out_pos, 0, sizeof(msg->out_pos));
+        msg->waiter = 0;
+        msg->replied = 0;
+        msg->status = PSA_SUCCESS;
+        msg->next = NULL;
+        return msg;
+    }
+
+    fprintf(stderr, "[SPM] Out of messages, raise SPM_MAX_MESSAGES\n");
+    abort();
+}
+
+static void spm_msg_free(spm_msg_t *msg)
+{
+    msg->in_use = 0;
+}
+
+/**
+    @brief    - Queues a message to its RoT Service and wakes the partition
+    @param    - msg : Message
+**/
+static void spm_msg_post(spm_msg_t *msg)
+{
+    spm_queue_t *queue = &spm_queues[msg->service];
+
+    if (queue->tail)
+        queue->tail->next = msg;
+    else
+        queue->head = msg;
+    queue->tail = msg;
+
+    pthread_cond_broadcast(&spm_partition_state[spm_services[msg->service].partition].cond);
+}
+
+/**
+    @brief    - Queues a message and waits for its reply
+    @param    - msg : Message
+    @return   - Status of the reply
+**/
+static psa_status_t spm_msg_send(spm_msg_t *msg)
+{
+    msg->waiter = 1;
+    spm_msg_post(msg);
+    while (!msg->replied)
+        pthread_cond_wait(&msg->replied_cond, &spm_lock);
+
+    return msg->status;
+}
+
+/**
+    @brief    - Looks up a message retrieved by the calling partition
+    @param    - handle : Message handle
+    @return   - Message, the caller panics on an invalid handle
+**/
+static spm_msg_t *spm_find_msg(psa_handle_t handle, const char *api)
+{
+    uint32_t   idx = SPM_HANDLE_IDX(handle);
+    spm_msg_t *msg;
+
+    if ((((uint32_t)handle & ~(SPM_HANDLE_IDX_MASK | (SPM_HANDLE_GEN_MASK << 16))) !=
+         SPM_MSG_HANDLE_FLAG) || (idx >= SPM_MAX_MESSAGES) || (spm_caller == SPM_NSPE))
+        spm_panic(api);
+
+    msg = &spm_msgs[idx];
+    if (!msg->in_use || !msg->fetched || (msg->gen != SPM_HANDLE_GEN(handle)) ||
+        ((int32_t)spm_services[msg->service].partition != spm_caller))
+        spm_panic(api);
+
+    return msg;
+}
+
+/* Client API */
+
+uint32_t psa_framework_version(void)
+{
+    return PSA_FRAMEWORK_VERSION;
+}
+
+uint32_t psa_version(uint32_t sid)
+{
+    uint32_t version = PSA_VERSION_NONE;
+    int32_t  service;
+
+    pthread_mutex_lock(&spm_lock);
+    service = spm_find_service(sid);
+    if ((service >= 0) && spm_service_allowed((uint32_t)service))
+        version = spm_services[service].version;
+    pthread_mutex_unlock(&spm_lock);
+
+    return version;
+}
+
+psa_handle_t psa_connect(uint32_t sid, uint32_t version)
+{
+    const spm_service_t *svc;
+    spm_conn_t          *conn = NULL;
+    spm_msg_t           *msg;
+    psa_status_t         status;
+    psa_handle_t         handle;
+    int32_t              service;
+    uint32_t             i;
+
+    pthread_mutex_lock(&spm_lock);
+
+    service = spm_find_service(sid);
+    if ((service < 0) || !spm_service_allowed((uint32_t)service))
+    {
+        pthread_mutex_unlock(&spm_lock);
+        return spm_client_error("psa_connect", PSA_ERROR_CONNECTION_REFUSED);
+    }
+
+    svc = &spm_services[service];
+    if ((svc->strict_version && (version != svc->version)) || (version > svc->version) ||
+        !svc->connection_based)
+    {
+        pthread_mutex_unlock(&spm_lock);
+        return spm_client_error("psa_connect", PSA_ERROR_CONNECTION_REFUSED);
+    }
+
+    for (i = 0; i < SPM_MAX_CONNECTIONS; i++)
+    {
+        if (spm_conns[i].state == SPM_CONN_FREE)
+        {
+            conn = &spm_conns[i];
+            break;
+        }
+    }
+    if (conn == NULL)
+    {
+        pthread_mutex_unlock(&spm_lock);
+        return PSA_ERROR_CONNECTION_BUSY;
+    }
+
+    conn->state = SPM_CONN_CONNECTING;
+    conn->gen = spm_next_gen();
+    conn->owner = spm_caller;
+    conn->service = (uint32_t)service;
+    conn->rhandle = NULL;
+
+    msg = spm_msg_alloc(PSA_IPC_CONNECT, (uint32_t)service, conn);
+    status = spm_msg_send(msg);
+    spm_msg_free(msg);
+
+    if (status == PSA_SUCCESS)
+    {
+        conn->state = SPM_CONN_ACTIVE;
+        handle = spm_conn_handle(conn);
+    }
+    else
+    {
+        conn->state = SPM_CONN_FREE;
+        handle = (psa_handle_t)status;
+    }
+
+    pthread_mutex_unlock(&spm_lock);
+
+    return handle;
+}
+
+psa_status_t psa_call(psa_handle_t handle, int32_t type,
+                      const psa_invec *in_vec, size_t in_len,
+                      psa_outvec *out_vec, size_t out_len)
+{
+    spm_conn_t   *conn = NULL;
+    spm_msg_t    *msg;
+    psa_status_t  status;
+    int32_t       service = -1;
+    uint32_t      i;
+
+    pthread_mutex_lock(&spm_lock);
+
+    for (i = 0; i < SPM_NUM_SERVICES; i++)
+    {
+        if (!spm_services[i].connection_based &&
+            ((uint32_t)handle == spm_services[i].stateless_handle))
+        {
+            service = (int32_t)i;
+            break;
+        }
+    }
+
+    if (service >= 0)
+    {
+        if (!spm_service_allowed((uint32_t)service))
+            goto programmer_error;
+    }
+    else
+    {
+        conn = spm_find_conn(handle);
+        if ((conn == NULL) || (conn->state != SPM_CONN_ACTIVE))
+            goto programmer_error;
+        service = (int32_t)conn->service;
+    }
+
+    if ((type < PSA_IPC_CALL) || (in_len > PSA_MAX_IOVEC) || (out_len > PSA_MAX_IOVEC) ||
+        (in_len + out_len > PSA_MAX_IOVEC))
+        goto programmer_error;
+
+    if (!spm_access_ok(spm_caller, in_vec, in_len * sizeof(psa_invec)) ||
+        !spm_access_ok(spm_caller, out_vec, out_len * sizeof(psa_outvec)))
+        goto programmer_error;
+
+    for (i = 0; i < in_len; i++)
+    {
+        if (!spm_access_ok(spm_caller, in_vec[i].base, in_vec[i].len))
+            goto programmer_error;
+    }
+    for (i = 0; i < out_len; i++)
+    {
+        if (!spm_access_ok(spm_caller, out_vec[i].base, out_vec[i].len) ||
+            !spm_writable_ok(out_vec[i].base, out_vec[i].len))
+            goto programmer_error;
+    }
+
+    msg = spm_msg_alloc(type, (uint32_t)service, conn);
+    for (i = 0; i < in_len; i++)
+        msg->in_vec[i] = in_vec[i];
+    for (i = 0; i < out_len; i++)
+        msg->out_vec[i] = out_vec[i];
+
+    status = spm_msg_send(msg);
+    for (i = 0; i < out_len; i++)
+        out_vec[i].len = msg->out_pos[i];
+    spm_msg_free(msg);
+
+    pthread_mutex_unlock(&spm_lock);
+
+    if (status == PSA_ERROR_PROGRAMMER_ERROR)
+        return spm_client_error("psa_call", status);
+
+    return status;
+
+programmer_error:
+    pthread_mutex_unlock(&spm_lock);
+    return spm_client_error("psa_call", PSA_ERROR_PROGRAMMER_ERROR);
+}
+
+void psa_close(psa_handle_t handle)
+{
+    spm_conn_t *conn;
+    spm_msg_t  *msg;
+
+    if (handle == PSA_NULL_HANDLE)
+        return;
+
+    pthread_mutex_lock(&spm_lock);
+
+    conn = spm_find_conn(handle);
+    if ((conn == NULL) || (conn->state == SPM_CONN_CONNECTING))
+    {
+        pthread_mutex_unlock(&spm_lock);
+        spm_client_error("psa_close", PSA_ERROR_PROGRAMMER_ERROR);
+        return;
+    }
+
+    /* A dropped connection had its PSA_IPC_DISCONNECT sent by the SPM */
+    if (conn->state == SPM_CONN_ACTIVE)
+    {
+        msg = spm_msg_alloc(PSA_IPC_DISCONNECT, conn->service, conn);
+        spm_msg_send(msg);
+        spm_msg_free(msg);
+    }
+    conn->state = SPM_CONN_FREE;
+
+    pthread_mutex_unlock(&spm_lock);
+}
+
+/* Secure partition API */
+
+psa_signal_t psa_wait(psa_signal_t signal_mask, uint32_t timeout)
+{
+    psa_signal_t signals;
+    uint32_t     partition;
+
+    pthread_mutex_lock(&spm_lock);
+
+    if ((spm_caller == SPM_NSPE) || !(signal_mask & spm_valid_signals((uint32_t)spm_caller)))
+        spm_panic("psa_wait");
+    partition = (uint32_t)spm_caller;
+
+    while (!(spm_signals(partition) & signal_mask) && (timeout & PSA_BLOCK))
+        pthread_cond_wait(&spm_partition_state[partition].cond, &spm_lock);
+    signals = spm_signals(partition) & signal_mask;
+
+    pthread_mutex_unlock(&spm_lock);
+
+    return signals;
+}
+
+psa_status_t psa_get(psa_signal_t signal, psa_msg_t *msg)
+{
+    spm_queue_t *queue = NULL;
+    spm_msg_t   *m;
+    uint32_t     i;
+
+    pthread_mutex_lock(&spm_lock);
+
+    if ((spm_caller == SPM_NSPE) || (signal == 0) || (signal & (signal - 1)))
+        spm_panic("psa_get");
+
+    for (i = 0; i < SPM_NUM_SERVICES; i++)
+    {
+        if (((int32_t)spm_services[i].partition == spm_caller) &&
+            (spm_services[i].signal == signal))
+        {
+            queue = &spm_queues[i];
+            break;
+        }
+    }
+    if ((queue == NULL) || (queue->head == NULL) ||
+        !spm_access_ok(spm_caller, msg, sizeof(*msg)))
+        spm_panic("psa_get");
+
+    m = queue->head;
+    queue->head = m->next;
+    if (queue->head == NULL)
+        queue->tail = NULL;
+    m->next = NULL;
+    m->fetched = 1;
+
+    msg->type = m->type;
+    msg->handle = SPM_HANDLE(SPM_MSG_HANDLE_FLAG, m - spm_msgs, m->gen);
+    msg->client_id = (m->owner == SPM_NSPE) ? SPM_NSPE_CLIENT_ID : spm_partitions[m->owner].id;
+    msg->rhandle = m->conn ? m->conn->rhandle : m->rhandle;
+    for (i = 0; i < PSA_MAX_IOVEC; i++)
+    {
+        msg->in_size[i] = m->in_vec[i].len;
+        msg->out_size[i] = m->out_vec[i].len;
+    }
+
+    pthread_mutex_unlock(&spm_lock);
+
+    return PSA_SUCCESS;
+}
+
+void psa_set_rhandle(psa_handle_t msg_handle, void *rhandle)
+{
+    spm_msg_t *msg;
+
+    pthread_mutex_lock(&spm_lock);
+
+    msg = spm_find_msg(msg_handle, "psa_set_rhandle");
+    if (msg->conn == NULL)
+        spm_panic("psa_set_rhandle");
+    /* Allowed during PSA_IPC_DISCONNECT, where it has no observable effect */
+    if (msg->type != PSA_IPC_DISCONNECT)
+        msg->conn->rhandle = rhandle;
+
+    pthread_mutex_unlock(&spm_lock);
+}
+
+size_t psa_read(psa_handle_t msg_handle, uint32_t invec_idx,
+                void *buffer, size_t num_bytes)
+{
+    spm_msg_t *msg;
+    size_t     bytes;
+
+    pthread_mutex_lock(&spm_lock);
+
+    msg = spm_find_msg(msg_handle, "psa_read");
+    if ((msg->type < PSA_IPC_CALL) || (invec_idx >= PSA_MAX_IOVEC) ||
+        !spm_access_ok(spm_caller, buffer, num_bytes))
+        spm_panic("psa_read");
+
+    bytes = msg->in_vec[invec_idx].len - msg->in_pos[invec_idx];
+    if (bytes > num_bytes)
+        bytes = num_bytes;
+    if (bytes)
+        spm_copy(buffer, (const uint8_t *)msg->in_vec[invec_idx].base + msg->in_pos[invec_idx], bytes);
+    msg->in_pos[invec_idx] += bytes;
+
+    pthread_mutex_unlock(&spm_lock);
+
+    return bytes;
+}
+
+size_t psa_skip(psa_handle_t msg_handle, uint32_t invec_idx, size_t num_bytes)
+{
+    spm_msg_t *msg;
+    size_t     bytes;
+
+    pthread_mutex_lock(&spm_lock);
+
+    msg = spm_find_msg(msg_handle, "psa_skip");
+    if ((msg->type < PSA_IPC_CALL) || (invec_idx >= PSA_MAX_IOVEC))
+        spm_panic("psa_skip");
+
+    bytes = msg->in_vec[invec_idx].len - msg->in_pos[invec_idx];
+    if (bytes > num_bytes)
+        bytes = num_bytes;
+    msg->in_pos[invec_idx] += bytes;
+
+    pthread_mutex_unlock(&spm_lock);
+
+    return bytes;
+}
+
+void psa_write(psa_handle_t msg_handle, uint32_t outvec_idx,
+               const void *buffer, size_t num_bytes)
+{
+    spm_msg_t *msg;
+
+    pthread_mutex_lock(&spm_lock);
+
+    msg = spm_find_msg(msg_handle, "psa_write");
+    if ((msg->type < PSA_IPC_CALL) || (outvec_idx >= PSA_MAX_IOVEC) ||
+        (num_bytes > msg->out_vec[outvec_idx].len - msg->out_pos[outvec_idx]) ||
+        !spm_access_ok(spm_caller, buffer, num_bytes))
+        spm_panic("psa_write");
+
+    if (num_bytes)
+        spm_copy((uint8_t *)msg->out_vec[outvec_idx].base + msg->out_pos[outvec_idx], buffer,
+                 num_bytes);
+    msg->out_pos[outvec_idx] += num_bytes;
+
+    pthread_mutex_unlock(&spm_lock);
+}
+
+void psa_reply(psa_handle_t msg_handle, psa_status_t status)
+{
+    spm_msg_t *msg, *disconnect;
+
+    pthread_mutex_lock(&spm_lock);
+
+    msg = spm_find_msg(msg_handle, "psa_reply");
+    if ((msg->type == PSA_IPC_CONNECT) && (status != PSA_SUCCESS) &&
+        (status != PSA_ERROR_CONNECTION_REFUSED) && (status != PSA_ERROR_CONNECTION_BUSY))
+        spm_panic("psa_reply");
+
+    /* The connection is dropped on a PROGRAMMER ERROR of the client, the SPM
+     * then sends the PSA_IPC_DISCONNECT on behalf of the client
+     */
+    if ((msg->type >= PSA_IPC_CALL) && (status == PSA_ERROR_PROGRAMMER_ERROR) && msg->conn)
+    {
+        msg->conn->state = SPM_CONN_DROPPED;
+        disconnect = spm_msg_alloc(PSA_IPC_DISCONNECT, msg->service, NULL);
+        disconnect->owner = msg->owner;
+        disconnect->rhandle = msg->conn->rhandle;
+        spm_msg_post(disconnect);
+    }
+
+    if (msg->waiter)
+    {
+        msg->status = status;
+        msg->replied = 1;
+        msg->fetched = 0;
+        pthread_cond_signal(&msg->replied_cond);
+    }
+    else
+    {
+        spm_msg_free(msg);
+    }
+
+    pthread_mutex_unlock(&spm_lock);
+}
+
+void psa_notify(int32_t partition_id)
+{
+    uint32_t i;
+
+    pthread_mutex_lock(&spm_lock);
+
+    for (i = 0; i < SPM_NUM_PARTITIONS; i++)
+    {
+        if (spm_partitions[i].id == partition_id)
+            break;
+    }
+    if ((spm_caller == SPM_NSPE) || (i == SPM_NUM_PARTITIONS))
+        spm_panic("psa_notify");
+
+    spm_partition_state[i].asserted |= PSA_DOORBELL;
+    pthread_cond_broadcast(&spm_partition_state[i].cond);
+
+    pthread_mutex_unlock(&spm_lock);
+}
+
+void psa_clear(void)
+{
+    pthread_mutex_lock(&spm_lock);
+
+    if ((spm_caller == SPM_NSPE) ||
+        !(spm_partition_state[spm_caller].asserted & PSA_DOORBELL))
+        spm_panic("psa_clear");
+    spm_partition_state[spm_caller].asserted &= ~PSA_DOORBELL;
+
+    pthread_mutex_unlock(&spm_lock);
+}
+
+static int32_t spm_find_irq(psa_signal_t irq_signal)
+{
+    uint32_t i;
+
+    for (i = 0; i < SPM_NUM_IRQS; i++)
+    {
+        if ((spm_irqs[i].partition == spm_caller) && (spm_irqs[i].signal == irq_signal))
+            return (int32_t)i;
+    }
+
+    return -1;
+}
+
+void psa_eoi(psa_signal_t irq_signal)
+{
+    int32_t irq;
+
+    pthread_mutex_lock(&spm_lock);
+
+    irq = spm_find_irq(irq_signal);
+    if ((irq < 0) || !(spm_partition_state[spm_caller].asserted & irq_signal))
+        spm_panic("psa_eoi");
+
+    /* Level sensitive, still pending if the line is high */
+    if (!spm_irq_state[irq].level || !spm_irq_state[irq].enabled)
+        spm_partition_state[spm_caller].asserted &= ~irq_signal;
+
+    pthread_mutex_unlock(&spm_lock);
+}
+
+void psa_irq_enable(psa_signal_t irq_signal)
+{
+    int32_t irq;
+
+    pthread_mutex_lock(&spm_lock);
+
+    irq = spm_find_irq(irq_signal);
+    if (irq < 0)
+        spm_panic("psa_irq_enable");
+
+    spm_irq_state[irq].enabled = 1;
+    if (spm_irq_state[irq].level)
+        spm_partition_state[spm_caller].asserted |= irq_signal;
+
+    pthread_mutex_unlock(&spm_lock);
+}
+
+psa_irq_status_t psa_irq_disable(psa_signal_t irq_signal)
+{
+    psa_irq_status_t enabled;
+    int32_t          irq;
+
+    pthread_mutex_lock(&spm_lock);
+
+    irq = spm_find_irq(irq_signal);
+    if (irq < 0)
+        spm_panic("psa_irq_disable");
+
+    enabled = spm_irq_state[irq].enabled;
+    spm_irq_state[irq].enabled = 0;
+
+    pthread_mutex_unlock(&spm_lock);
+
+    return enabled;
+}
+
+void psa_panic(void)
+{
+    spm_panic("psa_panic");
+}
+
+uint32_t psa_rot_lifecycle_state(void)
+{
+    return PSA_LIFECYCLE_SECURED;
+}
+
+/* Platform hooks */
+
+void spm_emul_irq_set_level(uint32_t source, uint32_t level)
+{
+    uint32_t i;
+
+    pthread_mutex_lock(&spm_lock);
+
+    for (i = 0; i < SPM_NUM_IRQS; i++)
+    {
+        if (spm_irqs[i].source != source)
+            continue;
+
+        if (level && !spm_irq_state[i].level && spm_irq_state[i].enabled)
+        {
+            spm_partition_state[spm_irqs[i].partition].asserted |= spm_irqs[i].signal;
+            pthread_cond_broadcast(&spm_partition_state[spm_irqs[i].partition].cond);
+        }
+        spm_irq_state[i].level = level ? 1 : 0;
+    }
+
+    pthread_mutex_unlock(&spm_lock);
+}
+
+/**
+    @brief    - Secure timestamp of the emulated platform. Linked with the
+                partitions rather than the driver partition so that every
+                partition reads it without a call to the SPM.
+    @param    - timestamp : Returns the current time in nano seconds
+    @return   - 0 on success
+**/
+int pal_get_timestamp_ns_s(uint64_t *timestamp)
+{
+    struct timespec ts;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &ts) != 0)
+        return 1;
+    *timestamp = ((uint64_t)ts.tv_sec * 1000000000u) + (uint64_t)ts.tv_nsec;
+
+    return 0;
+}
+
+uint8_t *spm_emul_nvmem(void)
+{
+    return spm_nvmem;
+}
+
+void spm_emul_reset(const char *reason)
+{
+    fflush(stdout);
+    fprintf(stderr, "\n[SPM] %s, resetting\n", reason);
+    fflush(NULL);
+
+    if (spm_reset_request != NULL)
+    {
+        *spm_reset_request = 1;
+        _exit(0);
+    }
+
+    execv("/proc/self/exe", spm_argv);
+
+    fprintf(stderr, "[SPM] Restart failed: %s\n", strerror(errno));
+    _exit(1);
+}
+
+static void *spm_watchdog(void *arg)
+{
+    struct timespec now;
+
+    (void)arg;
+    pthread_mutex_lock(&spm_wd_lock);
+    while (1)
+    {
+        if (!spm_wd_running)
+        {
+            pthread_cond_wait(&spm_wd_cond, &spm_wd_lock);
+            continue;
+        }
+
+        pthread_cond_timedwait(&spm_wd_cond, &spm_wd_lock, &spm_wd_deadline);
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if (spm_wd_running && ((now.tv_sec > spm_wd_deadline.tv_sec) ||
+            ((now.tv_sec == spm_wd_deadline.tv_sec) && (now.tv_nsec >= spm_wd_deadline.tv_nsec))))
+            spm_emul_reset("Watchdog timeout");
+    }
+
+    return NULL;
+}
+
+void spm_emul_watchdog_start(uint32_t timeout_us)
+{
+    pthread_mutex_lock(&spm_wd_lock);
+
+    clock_gettime(CLOCK_MONOTONIC, &spm_wd_deadline);
+    spm_wd_deadline.tv_sec += timeout_us / 1000000;
+    spm_wd_deadline.tv_nsec += (long)(timeout_us % 1000000) * 1000;
+    if (spm_wd_deadline.tv_nsec >= 1000000000)
+    {
+        spm_wd_deadline.tv_sec++;
+        spm_wd_deadline.tv_nsec -= 1000000000;
+    }
+    spm_wd_running = 1;
+    pthread_cond_signal(&spm_wd_cond);
+
+    pthread_mutex_unlock(&spm_wd_lock);
+}
+
+void spm_emul_watchdog_stop(void)
+{
+    pthread_mutex_lock(&spm_wd_lock);
+    spm_wd_running = 0;
+    pthread_cond_signal(&spm_wd_cond);
+    pthread_mutex_unlock(&spm_wd_lock);
+}
+
+int spm_emul_watchdog_is_running(void)
+{
+    int running;
+
+    pthread_mutex_lock(&spm_wd_lock);
+    running = spm_wd_running;
+    pthread_mutex_unlock(&spm_wd_lock);
+
+    return running;
+}
+
+static const char *spm_domain_name(int32_t domain)
+{
+    return (domain == SPM_NSPE) ? "NSPE" : spm_partitions[domain].name;
+}
+
+int spm_emul_isolation_probe(uint32_t index, spm_emul_isolation_case_t *iso_case)
+{
+    spm_region_t       region;
+    sigjmp_buf         env;
+    volatile uint32_t *addr;
+    volatile uint64_t  start = 0;
+    uint64_t           now = 0, end = 0;
+    uint32_t           i, regions = 0, region_idx;
+    int32_t            caller;
+    int                sig;
+
+    if (!spm_isolation)
+        return -1;
+
+    /* Cases are ordered by caller, then region, then access */
+    pthread_mutex_lock(&spm_lock);
+    for (i = 0; i < spm_num_regions; i++)
+        regions += spm_regions[i].isolated;
+    if (index >= (SPM_NUM_PARTITIONS + 1) * regions * 2)
+    {
+        pthread_mutex_unlock(&spm_lock);
+        return 1;
+    }
+    region_idx = (index / 2) % regions;
+    for (i = 0; i < spm_num_regions; i++)
+    {
+        if (spm_regions[i].isolated && (region_idx-- == 0))
+            break;
+    }
+    region = spm_regions[i];
+    pthread_mutex_unlock(&spm_lock);
+
+    caller = (int32_t)(index / (2 * regions)) - 1;
+    iso_case->caller = spm_domain_name(caller);
+    iso_case->owner = spm_domain_name(region.owner);
+    iso_case->region = region.name;
+    iso_case->write = index & 1;
+    iso_case->expect_fault = !spm_domain_access_ok(caller, region.owner);
+
+    /* The access is made from the domain of the caller, a fault returning here */
+    addr = (volatile uint32_t *)region.probe;
+    spm_isolation_enter(caller);
+    spm_probe_env = &env;
+    sig = sigsetjmp(env, 1);
+    if (sig == 0)
+    {
+        pal_get_timestamp_ns_s(&now);
+        start = now;
+        if (iso_case->write)
+            *addr = SPM_ISOLATION_PATTERN;
+        else
+            (void)*addr;
+    }
+    pal_get_timestamp_ns_s(&end);
+    spm_probe_env = NULL;
+    spm_isolation_enter(spm_caller);
+
+    iso_case->faulted = (sig != 0);
+    iso_case->elapsed_ns = (end > start) ? end - start : 0;
+
+    return 0;
+}
+
+/**
+    @brief    - Maps the NVMEM, inherited from the image before a reset
+    @return   - 0 on success
+**/
+static int spm_nvmem_init(void)
+{
+    const char *env = getenv(SPM_NVMEM_FD_ENV);
+    char        fd_str[16];
+    int         fd;
+
+    if (env != NULL)
+    {
+        fd = atoi(env);
+    }
+    else
+    {
+        fd = memfd_create("psa_nvmem", 0);
+        if ((fd < 0) || ftruncate(fd, SPM_EMUL_NVMEM_SIZE))
+            return 1;
+        snprintf(fd_str, sizeof(fd_str), "%d", fd);
+        setenv(SPM_NVMEM_FD_ENV, fd_str, 1);
+    }
+
+    spm_nvmem = mmap(NULL, SPM_EMUL_NVMEM_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (spm_nvmem == MAP_FAILED)
+    {
+        spm_nvmem = NULL;
+        return 1;
+    }
+
+    return 0;
+}
+
+/**
+    @brief    - Maps the memory regions of target.cfg at their addresses and
+                assigns them to the partitions
+    @return   - 0 on success
+**/
+static int spm_mmio_init(void)
+{
+    memory_desc_t *desc;
+    uintptr_t      low = UINTPTR_MAX, high = 0, page = (uintptr_t)sysconf(_SC_PAGESIZE);
+    uint32_t       i, p, r;
+    void          *addr;
+
+    for (i = 0; i < sizeof(spm_mmio_names)/sizeof(spm_mmio_names[0]); i++)
+    {
+        if (val_target_get_config(TARGET_CONFIG_CREATE_ID(GROUP_MEMORY, spm_mmio_names[i].cfg_id, 0),
+                                  (uint8_t **)&desc, (uint32_t *)sizeof(memory_desc_t)))
+            continue;
+        if ((desc->start == 0) && (desc->end == 0))
+            continue;
+
+        spm_regions[spm_num_regions].name = spm_mmio_names[i].name;
+        spm_regions[spm_num_regions].start = desc->start;
+        spm_regions[spm_num_regions].end = desc->end;
+        spm_regions[spm_num_regions].owner = SPM_NSPE;
+        /* Last word of the region, the tests use the first ones */
+        spm_regions[spm_num_regions].probe = (desc->end - 3) & ~(uintptr_t)3;
+        for (p = 0; p < SPM_NUM_PARTITIONS; p++)
+        {
+            for (r = 0; r < spm_partitions[p].num_mmio_regions; r++)
+            {
+                if (!strcmp(spm_partitions[p].mmio_regions[r], spm_mmio_names[i].name))
+                    spm_regions[spm_num_regions].owner = (int32_t)p;
+            }
+        }
+        if (desc->start < low)
+            low = desc->start;
+        if (desc->end > high)
+            high = desc->end;
+        spm_num_regions++;
+    }
+
+    if (spm_num_regions == 0)
+        return 0;
+
+    low &= ~(page - 1);
+    high = (high + page) & ~(page - 1);
+    addr = mmap((void *)low, high - low, PROT_READ | PROT_WRITE,
+                MAP_PRIVATE | MAP_ANONYMOUS | MAP_FIXED_NOREPLACE, -1, 0);
+    if (addr != (void *)low)
+    {
+        fprintf(stderr, "[SPM] Cannot map the memory regions at 0x%lx\n", (unsigned long)low);
+        return 1;
+    }
+
+    /* Keys are given per page, regions of different owners sharing a page stay unisolated */
+    for (i = 0; i < spm_num_regions; i++)
+    {
+        for (r = 0; r < spm_num_regions; r++)
+        {
+            if ((spm_regions[r].owner != spm_regions[i].owner) &&
+                ((spm_regions[r].start & ~(page - 1)) <= (spm_regions[i].end | (page - 1))) &&
+                ((spm_regions[i].start & ~(page - 1)) <= (spm_regions[r].end | (page - 1))))
+                break;
+        }
+        if (r == spm_num_regions)
+            spm_region_protect(&spm_regions[i]);
+    }
+
+    return 0;
+}
+
+/**
+    @brief    - Gives a protection key to every partition. Without keys, the memory
+                of the partitions is not isolated.
+**/
+static void spm_isolation_init(void)
+{
+    uint32_t p;
+
+    for (p = 0; p < SPM_NUM_PARTITIONS; p++)
+    {
+        spm_pkeys[p] = pkey_alloc(0, 0);
+        if (spm_pkeys[p] < 0)
+        {
+            while (p > 0)
+                pkey_free(spm_pkeys[--p]);
+            return;
+        }
+    }
+    spm_isolation = 1;
+}
+
+static void spm_ro_mappings_init(void)
+{
+    FILE          *maps = fopen("/proc/self/maps", "r");
+    unsigned long  start, end;
+    char           perms[5], line[512];
+
+    if (maps == NULL)
+        return;
+
+    while (fgets(line, sizeof(line), maps) && (spm_num_ro_mappings < SPM_MAX_RO_MAPPINGS))
+    {
+        if ((sscanf(line, "%lx-%lx %4s", &start, &end, perms) != 3) || (perms[1] == 'w'))
+            continue;
+        spm_ro_mappings[spm_num_ro_mappings].start = start;
+        spm_ro_mappings[spm_num_ro_mappings].end = end - 1;
+        spm_num_ro_mappings++;
+    }
+    fclose(maps);
+}
+
+#if SPM_EMUL_CHECKPOINT
+/**
+    @brief    - Checkpoints the power-on state of the emulated system. The calling
+                process waits in a loop for a child forked in that state, and forks
+                a new one whenever the running child is reset. Returns in the child.
+                The calling process must be single threaded.
+**/
+static void spm_checkpoint(void)
+{
+    pid_t checkpoint = getpid(), pid;
+    int   status;
+
+    spm_reset_request = mmap(NULL, sizeof(*spm_reset_request), PROT_READ | PROT_WRITE,
+                             MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+    if (spm_reset_request == MAP_FAILED)
+    {
+        spm_reset_request = NULL;
+        return;
+    }
+
+    while (1)
+    {
+        *spm_reset_request = 0;
+        fflush(NULL);
+        pid = fork();
+        if (pid < 0)
+        {
+            /* Resets fall back to restarting the process */
+            munmap((void *)spm_reset_request, sizeof(*spm_reset_request));
+            spm_reset_request = NULL;
+            return;
+        }
+        if (pid == 0)
+        {
+            /* The system doesn't outlive the checkpoint */
+            prctl(PR_SET_PDEATHSIG, SIGKILL);
+            if (getppid() != checkpoint)
+                _exit(1);
+            return;
+        }
+
+        while ((waitpid(pid, &status, 0) < 0) && (errno == EINTR))
+            ;
+        if (!*spm_reset_request)
+            break;
+    }
+
+    if (WIFEXITED(status))
+        exit(WEXITSTATUS(status));
+    exit(128 + (WIFSIGNALED(status) ? WTERMSIG(status) : 0));
+}
+#endif
+
+static void spm_partition_run(void)
+{
+    spm_partitions[spm_caller].entry();
+}
+
+/**
+    @brief    - Thread of a partition. The partition runs on a stack region of its
+                own, its fault handler on an alternate stack left to the default key.
+    @param    - arg : Partition index
+**/
+static void *spm_partition_entry(void *arg)
+{
+    uintptr_t    page = (uintptr_t)sysconf(_SC_PAGESIZE);
+    ucontext_t   partition_ctx, thread_ctx;
+    spm_region_t region = {0};
+    stack_t      altstack;
+    uint8_t     *stack;
+
+    spm_caller = (int32_t)(uintptr_t)arg;
+
+    altstack.ss_sp = malloc(SPM_ALTSTACK_SIZE);
+    altstack.ss_size = SPM_ALTSTACK_SIZE;
+    altstack.ss_flags = 0;
+    stack = mmap(NULL, SPM_PARTITION_STACK_SIZE + page, PROT_READ | PROT_WRITE,
+                 MAP_PRIVATE | MAP_ANONYMOUS | MAP_STACK, -1, 0);
+    if ((altstack.ss_sp == NULL) || (stack == MAP_FAILED) || sigaltstack(&altstack, NULL) ||
+        getcontext(&partition_ctx))
+    {
+        fprintf(stderr, "[SPM] Cannot start %s\n", spm_partitions[spm_caller].name);
+        return NULL;
+    }
+    /* Guard page below the stack */
+    mprotect(stack, page, PROT_NONE);
+
+    region.name = "stack";
+    region.start = (uintptr_t)stack + page;
+    region.end = region.start + SPM_PARTITION_STACK_SIZE - 1;
+    region.owner = spm_caller;
+    /* Deepest word, never reached by the partition */
+    region.probe = region.start;
+    spm_region_protect(&region);
+    spm_isolation_enter(spm_caller);
+
+    pthread_mutex_lock(&spm_lock);
+    if (spm_num_regions < SPM_MAX_REGIONS)
+        spm_regions[spm_num_regions++] = region;
+    pthread_mutex_unlock(&spm_lock);
+
+    partition_ctx.uc_stack.ss_sp = (void *)region.start;
+    partition_ctx.uc_stack.ss_size = SPM_PARTITION_STACK_SIZE;
+    partition_ctx.uc_link = &thread_ctx;
+    makecontext(&partition_ctx, spm_partition_run, 0);
+    swapcontext(&thread_ctx, &partition_ctx);
+
+    return NULL;
+}
+
+int spm_emul_start(char **argv)
+{
+    pthread_condattr_t attr;
+    pthread_t          watchdog;
+    struct sigaction   fault = {0};
+    uint32_t           i;
+
+    spm_argv = argv;
+    spm_isolation_init();
+    if (spm_nvmem_init() || spm_mmio_init())
+        return 1;
+    spm_ro_mappings_init();
+
+    /* SA_NODEFER keeps the signal unblocked across the restart, the handler runs
+     * on the alternate stack of the partitions as their own stack is protected
+     */
+    fault.sa_handler = spm_fault;
+    fault.sa_flags = SA_NODEFER | SA_ONSTACK;
+    sigaction(SIGSEGV, &fault, NULL);
+    sigaction(SIGBUS, &fault, NULL);
+    sigaction(SIGILL, &fault, NULL);
+
+#if SPM_EMUL_CHECKPOINT
+    /* Everything above is the power-on state, which resets restore */
+    spm_checkpoint();
+#endif
+
+    for (i = 0; i < SPM_MAX_MESSAGES; i++)
+        pthread_cond_init(&spm_msgs[i].replied_cond, NULL);
+
+    /* PSA-FF 1.0 has no psa_irq_enable(), interrupts start enabled */
+#if SPEC_VERSION != 11
+    for (i = 0; i < SPM_NUM_IRQS; i++)
+        spm_irq_state[i].enabled = 1;
+#endif
+
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(&spm_wd_cond, &attr);
+    pthread_condattr_destroy(&attr);
+    if (pthread_create(&watchdog, NULL, spm_watchdog, NULL))
+        return 1;
+    pthread_detach(watchdog);
+
+    for (i = 0; i < SPM_NUM_PARTITIONS; i++)
+    {
+        pthread_cond_init(&spm_partition_state[i].cond, NULL);
+        if (pthread_create(&spm_partition_state[i].thread, NULL, spm_partition_entry,
+                           (void *)(uintptr_t)i))
+            return 1;
+        pthread_detach(spm_partition_state[i].thread);
+    }
+
+    spm_isolation_enter(SPM_NSPE);
+
+    return 0;
+}
@@ -0,0 +1,82 @@
+#/** @file
+# * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+# * SPDX-License-Identifier : Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the "License");
+# * you may not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# *  http://www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an "AS IS" BASIS,
+# * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+#**/
+
+# Host SPM emulation of the linux target. Generates the psa_manifest headers
+# from the partition manifests and provides the PSA include paths of the IPC suite.
+
+set(SPM_EMUL_DIR	${PSA_ROOT_DIR}/platform/targets/tgt_dev_apis_linux/spm)
+set(SPM_EMUL_GEN_DIR	${CMAKE_CURRENT_BINARY_DIR}/spm_emul)
+file(GLOB SPM_EMUL_MANIFESTS ${PSA_ROOT_DIR}/platform/manifests/*.json)
+
+if(DEFINED SPEC_VERSION)
+	set(SPM_EMUL_SPEC_VERSION ${SPEC_VERSION})
+else()
+	set(SPM_EMUL_SPEC_VERSION "1.0")
+endif()
+# PSA-FF 1.1 builds take the manifests of platform/manifests/ff_1_1 in place of
+# the shared ones of the same name
+if(${SPM_EMUL_SPEC_VERSION} STREQUAL "1.1")
+	file(GLOB SPM_EMUL_MANIFESTS_1_1 ${PSA_ROOT_DIR}/platform/manifests/ff_1_1/*.json)
+	foreach(manifest ${SPM_EMUL_MANIFESTS_1_1})
+		get_filename_component(manifest_name ${manifest} NAME)
+		list(REMOVE_ITEM SPM_EMUL_MANIFESTS ${PSA_ROOT_DIR}/platform/manifests/${manifest_name})
+		list(APPEND SPM_EMUL_MANIFESTS ${manifest})
+	endforeach()
+endif()
+# Partitions share the host heap, which neither bounds them to the manifest
+# heap_size nor scrubs freed memory
+if(NOT DEFINED SP_HEAP_MEM_SUPP)
+	set(SP_HEAP_MEM_SUPP 0 CACHE INTERNAL "Default SP_HEAP_MEM_SUPP value" FORCE)
+	message(STATUS "[PSA] : Defaulting SP_HEAP_MEM_SUPP to ${SP_HEAP_MEM_SUPP} for the host SPM emulation")
+endif()
+
+# Partitions read the host monotonic clock
+if(NOT DEFINED SP_TIMESTAMP_SUPP)
+	set(SP_TIMESTAMP_SUPP 1 CACHE INTERNAL "Default SP_TIMESTAMP_SUPP value" FORCE)
+	message(STATUS "[PSA] : Defaulting SP_TIMESTAMP_SUPP to ${SP_TIMESTAMP_SUPP} for the host SPM emulation")
+endif()
+
+# A reset forks a new child from the power-on checkpoint, 0 restarts the process image
+if(NOT DEFINED SPM_EMUL_CHECKPOINT)
+	set(SPM_EMUL_CHECKPOINT 1 CACHE INTERNAL "Default SPM_EMUL_CHECKPOINT value" FORCE)
+	message(STATUS "[PSA] : Defaulting SPM_EMUL_CHECKPOINT to ${SPM_EMUL_CHECKPOINT}")
+elseif(NOT ((${SPM_EMUL_CHECKPOINT} EQUAL 0) OR (${SPM_EMUL_CHECKPOINT} EQUAL 1)))
+	message(FATAL_ERROR "[PSA] : Error: Unsupported value for -DSPM_EMUL_CHECKPOINT=${SPM_EMUL_CHECKPOINT}, supported values are : 0 1")
+endif()
+
+set(SPM_EMUL_STATELESS 0)
+if(DEFINED STATELESS_ROT_TESTS)
+	if(${STATELESS_ROT_TESTS} EQUAL 1)
+		set(SPM_EMUL_STATELESS 1)
+	endif()
+endif()
+
+execute_process(COMMAND ${PYTHON_EXECUTABLE} ${SPM_EMUL_DIR}/spm_manifest_gen.py
+			--output-dir ${SPM_EMUL_GEN_DIR}
+			--spec-version ${SPM_EMUL_SPEC_VERSION}
+			--stateless ${SPM_EMUL_STATELESS}
+			${SPM_EMUL_MANIFESTS}
+		RESULT_VARIABLE SPM_EMUL_GEN_RESULT)
+if(NOT ${SPM_EMUL_GEN_RESULT} EQUAL 0)
+	message(FATAL_ERROR "[PSA] : Couldn't generate the SPM emulation manifest files")
+endif()
+set_property(DIRECTORY APPEND PROPERTY CMAKE_CONFIGURE_DEPENDS
+	${SPM_EMUL_MANIFESTS} ${SPM_EMUL_DIR}/spm_manifest_gen.py
+	${PSA_ROOT_DIR}/tools/scripts/output_file.py)
+
+list(APPEND PSA_INCLUDE_PATHS ${SPM_EMUL_DIR}/include ${SPM_EMUL_GEN_DIR})
+message(STATUS "[PSA] : Using the host SPM emulation, PSA_INCLUDE_PATHS set to ${PSA_INCLUDE_PATHS}")
@@ -0,0 +1,99 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+#ifndef _SPM_EMUL_H_
+#define _SPM_EMUL_H_
+
+#include <stdint.h>
+
+#include "spm_emul_manifest.h"
+
+/* Size of the emulated non-volatile memory, preserved across emulated resets */
+#define SPM_EMUL_NVMEM_SIZE         1024
+
+/**
+    @brief    - Maps the emulated memory, starts one thread per secure partition
+                and the watchdog. The calling thread becomes the NSPE.
+    @param    - argv : Command line, used to restart the process on reset
+    @return   - 0 on success
+**/
+int spm_emul_start(char **argv);
+
+/**
+    @brief    - Emulates a system reset by restarting the process. The NVMEM
+                content is kept.
+    @param    - reason : Printed before the restart
+    @return   - Does not return
+**/
+void spm_emul_reset(const char *reason);
+
+/**
+    @brief    - Returns the emulated non-volatile memory
+    @return   - SPM_EMUL_NVMEM_SIZE bytes of NVMEM
+**/
+uint8_t *spm_emul_nvmem(void);
+
+/**
+    @brief    - Drives the level of an interrupt line. A rising level asserts
+                the irq signal of the owning partition when the irq is enabled.
+    @param    - source : SPM_EMUL_IRQ_<source> of the manifest irq
+                level  : 1 to raise the line, 0 to lower it
+**/
+void spm_emul_irq_set_level(uint32_t source, uint32_t level);
+
+/**
+    @brief    - Arms the watchdog, which resets the emulated system on expiry
+    @param    - timeout_us : Timeout in micro seconds
+**/
+void spm_emul_watchdog_start(uint32_t timeout_us);
+
+/**
+    @brief    - Disarms the watchdog
+**/
+void spm_emul_watchdog_stop(void);
+
+/**
+    @brief    - Returns the watchdog state
+    @return   - 1 when armed, 0 otherwise
+**/
+int spm_emul_watchdog_is_running(void);
+
+/* One case of the memory isolation matrix */
+typedef struct {
+    const char          *caller;
+    const char          *owner;
+    const char          *region;
+    uint32_t             write;
+    uint32_t             expect_fault;
+    uint32_t             faulted;
+    uint64_t             elapsed_ns;
+} spm_emul_isolation_case_t;
+
+/**
+    @brief    - Runs one case of the memory isolation matrix, which crosses the NSPE
+                and every partition as caller with every isolated region, stacks and
+                MMIO regions of the manifests, and a read then a write access. The
+                calling thread makes the access from the memory domain of the caller,
+                a fault being caught and timed instead of resetting the system.
+    @param    - index    : Case index, from 0
+                iso_case : Returns the case and its outcome
+    @return   - 0 on success, 1 past the last case, -1 when the memory of the
+                partitions is not isolated
+**/
+int spm_emul_isolation_probe(uint32_t index, spm_emul_isolation_case_t *iso_case);
+
+#endif /* _SPM_EMUL_H_ */
@@ -0,0 +1,209 @@
+#!/usr/bin/python
+#/** @file
+# * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+# * SPDX-License-Identifier : Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the "License");
+# * you may not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# *  http://www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an "AS IS" BASIS,
+# * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+#**/
+
+import os
+import sys
+import json
+from argparse import ArgumentParser
+
+# Keeps the source tree free of a __pycache__ directory
+sys.dont_write_bytecode = True
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)),
+				"..", "..", "..", "..", "tools", "scripts"))
+from output_file import output_file
+
+# Signals 0 to 3 are reserved by PSA-FF, bit 3 being PSA_DOORBELL
+FIRST_SIGNAL_BIT	= 4
+STATELESS_HANDLE_BASE	= 0x40000000
+
+HEADER_NOTE = "/* Generated by spm_manifest_gen.py from the partition manifests, do not edit */\n"
+
+def load_partitions(manifest_files, stateless):
+	"""
+	- Reads the manifests and assigns partition ids, signals and stateless handles.
+	"""
+	partitions = []
+	services = []
+	for path in sorted(manifest_files, key=os.path.basename):
+		with open(path, 'r') as f:
+			manifest = json.load(f)
+		partition = {
+			"name"		: manifest["name"],
+			"id"		: len(partitions) + 1,
+			"psa_rot"	: manifest["type"] == "PSA-ROT",
+			"entry_point"	: manifest["entry_point"],
+			"header"	: os.path.splitext(os.path.basename(path))[0] + ".h",
+			"services"	: [],
+			"irqs"		: [],
+			"dependencies"	: manifest.get("dependencies", []),
+			"mmio_regions"	: [r["name"] for r in manifest.get("mmio_regions", []) if "name" in r],
+		}
+		bit = FIRST_SIGNAL_BIT
+		for s in manifest.get("services", []):
+			service = {
+				"name"			: s["name"],
+				"sid"			: int(str(s["sid"]), 0),
+				"version"		: int(s.get("version", 1)),
+				"strict"		: s.get("version_policy", "STRICT") == "STRICT",
+				"non_secure_clients"	: bool(s.get("non_secure_clients", False)),
+				"connection_based"	: s.get("connection_based", not stateless),
+				"signal"		: bit,
+				"partition"		: len(partitions),
+				"index"			: len(services),
+			}
+			bit += 1
+			partition["services"].append(service)
+			services.append(service)
+		for irq in manifest.get("irqs", []):
+			partition["irqs"].append({"signal": irq["signal"], "source": irq["source"], "bit": bit})
+			bit += 1
+		if bit > 32:
+			sys.exit("%s: too many signals" % manifest["name"])
+		partitions.append(partition)
+
+	for service in services:
+		if not service["connection_based"]:
+			service["handle"] = STATELESS_HANDLE_BASE | (service["index"] << 8) | \
+					    (service["version"] & 0xFF)
+	return partitions, services
+
+def irq_signal_name(irq, spec_version):
+	"""
+	- PSA-FF 1.1 names the irq signal after the irq, with a _SIGNAL suffix.
+	"""
+	if spec_version == "1.1":
+		return irq["signal"] + "_SIGNAL"
+	return irq["signal"]
+
+def write_headers(out_dir, partitions, services, spec_version):
+	"""
+	- Writes psa_manifest/sid.h, pid.h and the per partition signal headers.
+	"""
+	manifest_dir = os.path.join(out_dir, "psa_manifest")
+	if not os.path.isdir(manifest_dir):
+		os.makedirs(manifest_dir)
+
+	with output_file(os.path.join(manifest_dir, "sid.h")) as f:
+		f.write(HEADER_NOTE + "\n#ifndef __PSA_MANIFEST_SID_H__\n#define __PSA_MANIFEST_SID_H__\n")
+		for p in partitions:
+			f.write("\n/* %s */\n" % p["name"])
+			for s in p["services"]:
+				f.write("#define %-40s (0x%08XU)\n" % (s["name"] + "_SID", s["sid"]))
+				f.write("#define %-40s (%uU)\n" % (s["name"] + "_VERSION", s["version"]))
+				if "handle" in s:
+					f.write("#define %-40s (0x%08X)\n" % (s["name"] + "_HANDLE", s["handle"]))
+		f.write("\n#endif /* __PSA_MANIFEST_SID_H__ */\n")
+
+	with output_file(os.path.join(manifest_dir, "pid.h")) as f:
+		f.write(HEADER_NOTE + "\n#ifndef __PSA_MANIFEST_PID_H__\n#define __PSA_MANIFEST_PID_H__\n\n")
+		for p in partitions:
+			f.write("#define %-40s (%d)\n" % (p["name"], p["id"]))
+		f.write("\n#endif /* __PSA_MANIFEST_PID_H__ */\n")
+
+	for p in partitions:
+		guard = "__PSA_MANIFEST_" + p["header"].upper().replace(".", "_") + "__"
+		with output_file(os.path.join(manifest_dir, p["header"])) as f:
+			f.write(HEADER_NOTE + "\n#ifndef %s\n#define %s\n\n" % (guard, guard))
+			for s in p["services"]:
+				f.write("#define %-40s (1U << %d)\n" % (s["name"] + "_SIGNAL", s["signal"]))
+			for irq in p["irqs"]:
+				f.write("#define %-40s (1U << %d)\n" % (irq_signal_name(irq, spec_version), irq["bit"]))
+			f.write("\n#endif /* %s */\n" % guard)
+
+def write_tables(out_dir, partitions, services):
+	"""
+	- Writes the partition, service and irq tables of the emulated SPM.
+	"""
+	sources = []
+	for p in partitions:
+		for irq in p["irqs"]:
+			if irq["source"] not in sources:
+				sources.append(irq["source"])
+	num_irqs = sum(len(p["irqs"]) for p in partitions)
+
+	with output_file(os.path.join(out_dir, "spm_emul_manifest.h")) as f:
+		f.write(HEADER_NOTE + "\n#ifndef _SPM_EMUL_MANIFEST_H_\n#define _SPM_EMUL_MANIFEST_H_\n\n")
+		f.write("#define SPM_NUM_PARTITIONS           %d\n" % len(partitions))
+		f.write("#define SPM_NUM_SERVICES             %d\n" % len(services))
+		f.write("#define SPM_NUM_IRQS                 %d\n" % num_irqs)
+		f.write("#define SPM_NUM_IRQ_SOURCES          %d\n\n" % len(sources))
+		f.write("/* Interrupt sources, as passed to spm_emul_irq_set_level() */\n")
+		for i, source in enumerate(sources):
+			f.write("#define SPM_EMUL_IRQ_%-30s %d\n" % (source, i))
+		f.write("\n#endif /* _SPM_EMUL_MANIFEST_H_ */\n")
+
+	names = {s["name"]: s["index"] for s in services}
+	with output_file(os.path.join(out_dir, "spm_emul_manifest.inc")) as f:
+		f.write(HEADER_NOTE + "\n")
+		for p in partitions:
+			f.write("void %s(void);\n" % p["entry_point"])
+		f.write("\n")
+		for p in partitions:
+			lower = p["name"].lower()
+			if p["dependencies"]:
+				for dep in p["dependencies"]:
+					if dep not in names:
+						sys.exit("%s: unknown dependency %s" % (p["name"], dep))
+				f.write("static const uint32_t %s_dependencies[] = {%s};\n" %
+					(lower, ", ".join(str(names[d]) for d in p["dependencies"])))
+			if p["mmio_regions"]:
+				f.write("static const char *const %s_mmio_regions[] = {%s};\n" %
+					(lower, ", ".join('"%s"' % r for r in p["mmio_regions"])))
+
+		f.write("\nstatic const spm_partition_t spm_partitions[SPM_NUM_PARTITIONS] = {\n")
+		for p in partitions:
+			lower = p["name"].lower()
+			deps = (lower + "_dependencies", len(p["dependencies"])) if p["dependencies"] else ("NULL", 0)
+			mmio = (lower + "_mmio_regions", len(p["mmio_regions"])) if p["mmio_regions"] else ("NULL", 0)
+			f.write("    {\"%s\", %d, %d, %s, %s, %d, %s, %d},\n" %
+				(p["name"], p["id"], 1 if p["psa_rot"] else 0, p["entry_point"],
+				 deps[0], deps[1], mmio[0], mmio[1]))
+		f.write("};\n")
+
+		f.write("\nstatic const spm_service_t spm_services[SPM_NUM_SERVICES] = {\n")
+		for s in services:
+			f.write("    {\"%s\", 0x%08XU, %uU, %d, (1U << %d), %d, %d, %d, 0x%08X},\n" %
+				(s["name"], s["sid"], s["version"], 1 if s["strict"] else 0, s["signal"],
+				 s["partition"], 1 if s["non_secure_clients"] else 0,
+				 1 if s["connection_based"] else 0, s.get("handle", 0)))
+		f.write("};\n")
+
+		f.write("\nstatic const spm_irq_t spm_irqs[SPM_NUM_IRQS + 1] = {\n")
+		for i, p in enumerate(partitions):
+			for irq in p["irqs"]:
+				f.write("    {(1U << %d), SPM_EMUL_IRQ_%s, %d},\n" % (irq["bit"], irq["source"], i))
+		f.write("    {0, 0, -1},\n};\n")
+
+def argparse():
+	"""
+	Parse the command line argument
+	"""
+	parser = ArgumentParser(description='Generates the psa_manifest headers and the SPM tables \
+					of the linux host IPC emulation from the partition manifests.')
+	parser.add_argument('--output-dir', required=True, help='Directory receiving the generated files')
+	parser.add_argument('--spec-version', default='1.0', help='PSA-FF version, 1.0 or 1.1')
+	parser.add_argument('--stateless', type=int, default=0, help='1 to make every RoT Service stateless unless its manifest sets connection_based')
+	parser.add_argument('manifests', nargs='+', help='Partition manifest files')
+	return parser.parse_args()
+
+#main code starts here
+if __name__ == "__main__":
+	options = argparse()
+	partitions, services = load_partitions(options.manifests, options.stateless)
+	write_headers(options.output_dir, partitions, services, options.spec_version)
+	write_tables(options.output_dir, partitions, services)
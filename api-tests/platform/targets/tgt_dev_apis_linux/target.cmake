@@ -31,35 +31,47 @@ list(APPEND PAL_SRC_ASM_DRIVER_SP )
 
 # Listing all the sources required for given target
 if(${SUITE} STREQUAL "IPC")
-	message(FATAL_ERROR "IPC not supported")
+	list(APPEND PAL_SRC_C_NSPE
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/pal_driver_intf.c
+		# driver functionalities are implemented as RoT-services of the driver partition,
+		# run with the other partitions by the host SPM emulation
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/pal_driver_ipc_intf.c
+	)
+	list(APPEND PAL_SRC_C_DRIVER_SP
+		# Driver files will be compiled as part of driver partition
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/spe/pal_driver_intf.c
+	)
+	list(APPEND PAL_DRIVER_INCLUDE_PATHS
+		${SPM_EMUL_DIR}
+	)
 else()
 	list(APPEND PAL_SRC_C_NSPE
 		# driver files will be compiled as part of NSPE
 		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/pal_driver_intf.c
 	)
 endif()
-if(${SUITE} STREQUAL "CRYPTO")
+if("CRYPTO" IN_LIST PSA_SUITE_LIST)
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/crypto/pal_crypto_intf.c
 	)
 endif()
-if(${SUITE} STREQUAL "PROTECTED_STORAGE")
+if("PROTECTED_STORAGE" IN_LIST PSA_SUITE_LIST)
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/protected_storage/pal_protected_storage_intf.c
 	)
 endif()
-if(${SUITE} STREQUAL "INTERNAL_TRUSTED_STORAGE")
+if("INTERNAL_TRUSTED_STORAGE" IN_LIST PSA_SUITE_LIST)
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/internal_trusted_storage/pal_internal_trusted_storage_intf.c
 	)
 endif()
-if(${SUITE} STREQUAL "STORAGE")
+if("STORAGE" IN_LIST PSA_SUITE_LIST)
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/internal_trusted_storage/pal_internal_trusted_storage_intf.c
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/protected_storage/pal_protected_storage_intf.c
 	)
 endif()
-if(${SUITE} STREQUAL "INITIAL_ATTESTATION")
+if("INITIAL_ATTESTATION" IN_LIST PSA_SUITE_LIST)
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/initial_attestation/pal_attestation_intf.c
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/initial_attestation/pal_attestation_crypto.c
@@ -86,9 +98,101 @@ target_include_directories(${PSA_TARGET_PAL_NSPE_LIB} PRIVATE
 	${PSA_ROOT_DIR}/platform/targets/common/nspe/initial_attestation
 	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe
 )
+if(${SUITE} STREQUAL "IPC")
+	# The memory isolation matrix is run by the host SPM emulation
+	target_include_directories(${PSA_TARGET_PAL_NSPE_LIB} PRIVATE ${SPM_EMUL_DIR})
+endif()
 
-if(${SUITE} STREQUAL "INITIAL_ATTESTATION")
+if(${SUITE} STREQUAL "IPC")
+	# Every partition library is linked into a relocatable object exporting its
+	# entry point only, the partitions and the NSPE then keep their own copies of
+	# the VAL and test symbols as they would in separate images
+	if(NOT CMAKE_OBJCOPY)
+		find_program(CMAKE_OBJCOPY objcopy)
+	endif()
+	# The heap test of i067 reads freed memory on purpose, newer host compilers reject it
+	include(CheckCCompilerFlag)
+	check_c_compiler_flag(-Wno-use-after-free PSA_HAS_WNO_USE_AFTER_FREE)
+	if(PSA_HAS_WNO_USE_AFTER_FREE)
+		set_source_files_properties(${PSA_ROOT_DIR}/ff/ipc/test_i067/test_supp_i067.c
+			PROPERTIES COMPILE_OPTIONS -Wno-use-after-free)
+	endif()
+	foreach(partition driver client server)
+		string(TOUPPER ${partition} PARTITION_UPPER)
+		set(partition_obj ${CMAKE_CURRENT_BINARY_DIR}/partition/${partition}_partition.o)
+		add_custom_command(OUTPUT ${partition_obj}
+			COMMAND ${CMAKE_C_COMPILER} -r -nostdlib -o ${partition_obj}
+				-Wl,--whole-archive $<TARGET_FILE:${PSA_TARGET_${PARTITION_UPPER}_PARTITION_LIB}>
+				-Wl,--no-whole-archive
+			COMMAND ${CMAKE_OBJCOPY} --keep-global-symbol=${partition}_main ${partition_obj}
+			DEPENDS ${PSA_TARGET_${PARTITION_UPPER}_PARTITION_LIB}
+		)
+		list(APPEND SPM_EMUL_PARTITION_OBJS ${partition_obj})
+	endforeach()
+
+	# Test executable, the NSPE running on the main thread of the SPM emulation
+	add_executable(psa-ipc-tests
+		${SPM_EMUL_DIR}/spm_emul.c
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/main.c
+		${SPM_EMUL_PARTITION_OBJS}
+	)
+	set_source_files_properties(${SPM_EMUL_DIR}/spm_emul.c PROPERTIES COMPILE_DEFINITIONS VAL_NSPE_BUILD)
+	target_compile_definitions(psa-ipc-tests PRIVATE SPM_EMUL_CHECKPOINT=${SPM_EMUL_CHECKPOINT})
+	foreach(psa_inc_path ${PSA_INCLUDE_PATHS})
+		target_include_directories(psa-ipc-tests PRIVATE ${psa_inc_path})
+	endforeach()
+	target_include_directories(psa-ipc-tests PRIVATE
+		${CMAKE_CURRENT_BINARY_DIR}
+		${SPM_EMUL_DIR}
+		${PSA_ROOT_DIR}/val/common
+		${PSA_ROOT_DIR}/val/nspe
+		${PSA_ROOT_DIR}/platform/targets/common/nspe
+		${PSA_ROOT_DIR}/platform/targets/common/nspe/crypto
+		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe
+	)
+	target_link_libraries(psa-ipc-tests
+		${PSA_TARGET_VAL_NSPE_LIB}
+		${PSA_TARGET_TEST_COMBINE_LIB}
+		${PSA_TARGET_VAL_NSPE_LIB}
+		${PSA_TARGET_PAL_NSPE_LIB}
+		pthread
+	)
+endif()
+
+if("INITIAL_ATTESTATION" IN_LIST PSA_SUITE_LIST)
 	target_include_directories(${PSA_TARGET_PAL_NSPE_LIB} PRIVATE
 		${PSA_QCBOR_INCLUDE_PATH}
 	)
+
+	# Optional batch token verifier and verifier fuzzing harness, built when the
+	# attestation library to link is given
+	if(DEFINED PSA_INITIAL_ATTESTATION_LIB_FILENAME)
+		add_executable(psa-attest-verify ${PSA_ROOT_DIR}/tools/utils/attest_verify/attest_verify.c)
+		add_executable(psa-attest-fuzz ${PSA_ROOT_DIR}/tools/utils/attest_fuzz/attest_fuzz.c)
+		if("${PSA_ATTEST_FUZZ_ENGINE}" STREQUAL "libfuzzer")
+			target_compile_definitions(psa-attest-fuzz PRIVATE ATTEST_FUZZ_LIBFUZZER)
+			set_target_properties(psa-attest-fuzz PROPERTIES LINK_FLAGS "-fsanitize=fuzzer")
+		endif()
+		foreach(attest_tool psa-attest-verify psa-attest-fuzz)
+			foreach(psa_inc_path ${PSA_INCLUDE_PATHS})
+				target_include_directories(${attest_tool} PRIVATE ${psa_inc_path})
+			endforeach()
+			target_include_directories(${attest_tool} PRIVATE
+				${CMAKE_CURRENT_BINARY_DIR}
+				${PSA_QCBOR_INCLUDE_PATH}
+				${PSA_ROOT_DIR}/val/common
+				${PSA_ROOT_DIR}/val/nspe
+				${PSA_ROOT_DIR}/platform/targets/common/nspe
+				${PSA_ROOT_DIR}/platform/targets/common/nspe/crypto
+				${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe
+			)
+			target_link_libraries(${attest_tool}
+				${PROJECT_BINARY_DIR}/val/val_nspe.a
+				${PROJECT_BINARY_DIR}/platform/pal_nspe.a
+				${PSA_INITIAL_ATTESTATION_LIB_FILENAME}
+				pthread
+			)
+			add_dependencies(${attest_tool} ${PSA_TARGET_VAL_NSPE_LIB} ${PSA_TARGET_PAL_NSPE_LIB})
+		endforeach()
+	endif()
 endif()
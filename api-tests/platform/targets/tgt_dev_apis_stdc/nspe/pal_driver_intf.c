@@ -20,7 +20,9 @@
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
 #include "pal_common.h"
 
@@ -198,3 +200,35 @@ int pal_system_reset(void)
 {
     return PAL_STATUS_UNSUPPORTED_FUNC;
 }
+
+/**
+ *   @brief    - Returns the spec version whose tests a spec version matrix build
+ *               runs, read from the PSA_SPEC_VERSION environment variable
+ *   @return   - Spec version, as given to -DSPEC_VERSION, or NULL for the newest one
+**/
+char *pal_get_spec_version(void)
+{
+    return getenv("PSA_SPEC_VERSION");
+}
+
+/**
+ *   @brief    - Reads a free running timestamp used by benchmark tests
+ *
+ *   Standard C99 only provides processor time through clock(), which is
+ *   what this implementation reports. The resolution is CLOCKS_PER_SEC.
+ *
+ *   @param    - timestamp : Returns the current time in nano seconds
+ *   @return   - SUCCESS/FAILURE
+**/
+int pal_get_timestamp_ns(uint64_t *timestamp)
+{
+    clock_t ticks = clock();
+
+    if (ticks == (clock_t)-1)
+    {
+        return PAL_STATUS_ERROR;
+    }
+    *timestamp = ((uint64_t)(ticks / CLOCKS_PER_SEC) * 1000000000u) +
+                 (((uint64_t)(ticks % CLOCKS_PER_SEC) * 1000000000u) / CLOCKS_PER_SEC);
+    return PAL_STATUS_SUCCESS;
+}
@@ -33,7 +33,8 @@
 # ARGUMENTS:
 #   _exe_name     Name of the test binary to generate.
 #   _api_dir      PSA API directory name e.g. crypto,
-#                 internal_trusted_storage or protected_storage.
+#                 internal_trusted_storage or protected_storage, or
+#                 combined for the combined DEV_APIS suite.
 ###############################################################################
 function(_create_psa_stdc_exe _exe_name _api_dir)
 
@@ -51,7 +52,8 @@ function(_create_psa_stdc_exe _exe_name _api_dir)
 	)
 
 	add_executable(${EXE_NAME} ${EXE_SRC})
-	target_link_libraries(${EXE_NAME} ${EXE_LIBS} ${PSA_CRYPTO_LIB_FILENAME} ${PSA_STORAGE_LIB_FILENAME})
+	target_link_libraries(${EXE_NAME} ${EXE_LIBS} ${PSA_INITIAL_ATTESTATION_LIB_FILENAME}
+		${PSA_CRYPTO_LIB_FILENAME} ${PSA_STORAGE_LIB_FILENAME})
 	add_dependencies(${EXE_NAME} ${PSA_TARGET_TEST_COMBINE_LIB})
 endfunction(_create_psa_stdc_exe)
 
@@ -76,34 +78,40 @@ else()
 		${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe/pal_driver_intf.c
 	)
 endif()
-if(${SUITE} STREQUAL "CRYPTO")
+if("CRYPTO" IN_LIST PSA_SUITE_LIST)
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/crypto/pal_crypto_intf.c
 	)
 	if(NOT DEFINED PSA_CRYPTO_LIB_FILENAME)
 		message(FATAL_ERROR "ERROR: PSA_CRYPTO_LIB_FILENAME undefined.")
 	endif()
-	_create_psa_stdc_exe(psa-arch-tests-crypto crypto)
+	if(NOT ${SUITE} STREQUAL "DEV_APIS")
+		_create_psa_stdc_exe(psa-arch-tests-crypto crypto)
+	endif()
 endif()
-if(${SUITE} STREQUAL "PROTECTED_STORAGE")
+if("PROTECTED_STORAGE" IN_LIST PSA_SUITE_LIST)
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/protected_storage/pal_protected_storage_intf.c
 	)
 	if(NOT DEFINED PSA_STORAGE_LIB_FILENAME)
 		message(FATAL_ERROR "ERROR: PSA_STORAGE_LIB_FILENAME undefined.")
 	endif()
-	_create_psa_stdc_exe(psa-arch-tests-storage storage)
+	if(NOT ${SUITE} STREQUAL "DEV_APIS")
+		_create_psa_stdc_exe(psa-arch-tests-storage storage)
+	endif()
 endif()
-if(${SUITE} STREQUAL "INTERNAL_TRUSTED_STORAGE")
+if("INTERNAL_TRUSTED_STORAGE" IN_LIST PSA_SUITE_LIST)
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/internal_trusted_storage/pal_internal_trusted_storage_intf.c
 	)
 	if(NOT DEFINED PSA_STORAGE_LIB_FILENAME)
 		message(FATAL_ERROR "ERROR: PSA_STORAGE_LIB_FILENAME undefined.")
 	endif()
-	_create_psa_stdc_exe(psa-arch-tests-storage storage)
+	if(NOT ${SUITE} STREQUAL "DEV_APIS")
+		_create_psa_stdc_exe(psa-arch-tests-storage storage)
+	endif()
 endif()
-if(${SUITE} STREQUAL "STORAGE")
+if("STORAGE" IN_LIST PSA_SUITE_LIST)
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/internal_trusted_storage/pal_internal_trusted_storage_intf.c
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/protected_storage/pal_protected_storage_intf.c
@@ -111,9 +119,11 @@ if(${SUITE} STREQUAL "STORAGE")
 	if(NOT DEFINED PSA_STORAGE_LIB_FILENAME)
 		message(FATAL_ERROR "ERROR: PSA_STORAGE_LIB_FILENAME undefined.")
 	endif()
-	_create_psa_stdc_exe(psa-arch-tests-storage storage)
+	if(NOT ${SUITE} STREQUAL "DEV_APIS")
+		_create_psa_stdc_exe(psa-arch-tests-storage storage)
+	endif()
 endif()
-if(${SUITE} STREQUAL "INITIAL_ATTESTATION")
+if("INITIAL_ATTESTATION" IN_LIST PSA_SUITE_LIST)
 	list(APPEND PAL_SRC_C_NSPE
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/initial_attestation/pal_attestation_intf.c
 		${PSA_ROOT_DIR}/platform/targets/common/nspe/initial_attestation/pal_attestation_crypto.c
@@ -125,8 +135,15 @@ if(${SUITE} STREQUAL "INITIAL_ATTESTATION")
 	if(NOT DEFINED PSA_INITIAL_ATTESTATION_LIB_FILENAME)
 		message(FATAL_ERROR "ERROR: PSA_STORAGE_LIB_FILENAME undefined.")
 	endif()
-_create_psa_stdc_exe(psa-arch-tests-initial-attestation initial-attestation)
+if(NOT ${SUITE} STREQUAL "DEV_APIS")
+	_create_psa_stdc_exe(psa-arch-tests-initial-attestation initial-attestation)
+endif()
+
+endif()
 
+# The combined DEV_APIS suite links the tests of all its suites into one runner
+if(${SUITE} STREQUAL "DEV_APIS")
+	_create_psa_stdc_exe(psa-arch-tests-dev-apis combined)
 endif()
 
 # Create NSPE library
@@ -146,7 +163,7 @@ target_include_directories(${PSA_TARGET_PAL_NSPE_LIB} PRIVATE
 	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe
 )
 
-if(${SUITE} STREQUAL "INITIAL_ATTESTATION")
+if("INITIAL_ATTESTATION" IN_LIST PSA_SUITE_LIST)
 	target_include_directories(${PSA_TARGET_PAL_NSPE_LIB} PRIVATE
 		${PSA_QCBOR_INCLUDE_PATH}
 	)
@@ -15,7 +15,7 @@
 # * limitations under the License.
 #**/
 
-if(${SUITE} STREQUAL "INITIAL_ATTESTATION")
+if((${SUITE} STREQUAL "INITIAL_ATTESTATION") OR (${SUITE} STREQUAL "DEV_APIS"))
 set(PSA_QCBOR_GIT_REPO_LINK		https://github.com/laurencelundblade/QCBOR.git)
 set(PSA_QCBOR_GIT_REPO_TAG              42272e466a8472948bf8fca076d113b81b99f0e0)
 endif()
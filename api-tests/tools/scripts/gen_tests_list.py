@@ -18,10 +18,14 @@
 
 import sys
 
-if (len(sys.argv) != 14):
+# Keeps the source tree free of a __pycache__ directory
+sys.dont_write_bytecode = True
+from output_file import output_file
+
+if (len(sys.argv) != 19):
         print("\nScript requires following inputs")
-        print("\narg1  : <INPUT  SUITE identifier>")
-        print("\narg2  : <INPUT  testsuite.db file>")
+        print("\narg1  : <INPUT  SUITE identifier, or comma separated list of them>")
+        print("\narg2  : <INPUT  testsuite.db file, or comma separated list, one per SUITE>")
         print("\narg3  : <INPUT  panic test>")
         print("\narg4  : <INPUT  tests coverage>")
         print("\narg5  : <OUTPUT testlist file>")
@@ -33,10 +37,15 @@ if (len(sys.argv) != 14):
         print("\narg11 : <OUTPUT server_tests_list>")
         print("\narg12 : <OUTPUT Suite test start number")
         print("\narg13 : <OUTPUT Suite test end number")
+        print("\narg14 : <INPUT  benchmark test>")
+        print("\narg15 : <OUTPUT test_entry_index>")
+        print("\narg16 : <INPUT  spec version of each testsuite.db file, comma separated, or None>")
+        print("\narg17 : <OUTPUT test_entry_spec_list>")
+        print("\narg18 : <OUTPUT spec_version_list>")
         sys.exit(1)
 
-suite                      = sys.argv[1]
-testsuite_db_file          = sys.argv[2]
+suites                     = sys.argv[1].split(',')
+testsuite_db_files         = sys.argv[2].split(',')
 panic_tests_included       = int(sys.argv[3])
 tests_coverage             = sys.argv[4]
 testlist_file              = sys.argv[5]
@@ -56,40 +65,78 @@ if sys.argv[13] != "None":
 	suite_test_end_number      = int(sys.argv[13])
 else:
 	suite_test_end_number      = sys.maxsize
+benchmark_tests_included   = int(sys.argv[14])
+test_entry_index           = sys.argv[15]
+if sys.argv[16] != "None":
+	spec_versions          = sys.argv[16].split(',')
+else:
+	spec_versions          = []
+test_entry_spec_list       = sys.argv[17]
+spec_version_list          = sys.argv[18]
 
 # Dictionary to hold the mapping between suite and the base number
 suite_with_base_dict = {"ipc":0, "crypto":1, "internal_trusted_storage":2, "protected_storage":2, "storage":2, "initial_attestation":3}
 
+# Suite of each test of the testlist, a combined build listing several suites
+test_suite_dict = {}
+
+# Mask of the spec versions each test of the testlist applies to, bit i standing
+# for the i-th testsuite.db file of a spec version matrix
+test_spec_dict = {}
+
 def gen_test_list():
 	"""
-	Read the input testsuite.db file and generates the output file with list of tests
+	Read the input testsuite.db files and generates the output file with list of tests
 	"""
-	with open(testlist_file, mode='w') as o_f:
-		with open(testsuite_db_file, mode='r') as i_f:
-			for line in i_f:
-				if (('test_' == line[0:5]) and
-				    (int(line[6:9]) >= suite_test_start_number) and
-				    (int(line[6:9]) <= suite_test_end_number)):
-					if (panic_tests_included == 0):
-						if (tests_coverage == "ALL"):
-							if (("panic" not in line) and ("failing" not in line) and ("skip" not in line)):
-								o_f.write(line)
-							if (("panic" not in line) and ("failing" in line) and ("skip" not in line)):
-								o_f.write(line[0:line.find(',')]+'\n')
-						if (tests_coverage == "PASS"):
-							if (("panic" not in line) and ("failing" not in line) and ("skip" not in line)):
-								o_f.write(line)
-					if (panic_tests_included == 1):
-						if (tests_coverage == "ALL"):
-							if (("panic" not in line) and ("failing" not in line) and ("skip" not in line)):
-								o_f.write(line)
-							else:
-								o_f.write(line[0:line.find(',')]+'\n')
-						if (tests_coverage == "PASS"):
-							if (("panic" not in line) and ("failing" not in line) and ("skip" not in line)):
-								o_f.write(line)
-							if (("panic" in line) and ("failing" not in line) and ("skip" not in line)):
-								o_f.write(line[0:line.find(',')]+'\n')
+	if (len(suites) != len(testsuite_db_files)):
+		print("\nProvide one testsuite.db file per SUITE identifier")
+		sys.exit(1)
+	if (spec_versions and (len(spec_versions) != len(testsuite_db_files))):
+		print("\nProvide one spec version per testsuite.db file")
+		sys.exit(1)
+
+	with output_file(testlist_file) as o_f:
+		for db_index, (suite, testsuite_db_file) in enumerate(zip(suites, testsuite_db_files)):
+			selected = []
+			with open(testsuite_db_file, mode='r') as i_f:
+				for line in i_f:
+					if (('test_' == line[0:5]) and
+					    (int(line[6:9]) >= suite_test_start_number) and
+					    (int(line[6:9]) <= suite_test_end_number)):
+						test_suite_dict[line[0:9]] = suite
+						# Benchmark tests are opt-in, drop only that tag once selected so the
+						# panic and coverage filters below still see the other tags
+						if ("benchmark" in line):
+							if (benchmark_tests_included == 0):
+								continue
+							line = ','.join(tag for tag in line.rstrip('\n').split(',')
+									if (tag.strip() != "benchmark_test"))+'\n'
+						if (panic_tests_included == 0):
+							if (tests_coverage == "ALL"):
+								if (("panic" not in line) and ("failing" not in line) and ("skip" not in line)):
+									selected.append(line)
+								if (("panic" not in line) and ("failing" in line) and ("skip" not in line)):
+									selected.append(line[0:line.find(',')]+'\n')
+							if (tests_coverage == "PASS"):
+								if (("panic" not in line) and ("failing" not in line) and ("skip" not in line)):
+									selected.append(line)
+						if (panic_tests_included == 1):
+							if (tests_coverage == "ALL"):
+								if (("panic" not in line) and ("failing" not in line) and ("skip" not in line)):
+									selected.append(line)
+								else:
+									selected.append(line[0:line.find(',')]+'\n')
+							if (tests_coverage == "PASS"):
+								if (("panic" not in line) and ("failing" not in line) and ("skip" not in line)):
+									selected.append(line)
+								if (("panic" in line) and ("failing" not in line) and ("skip" not in line)):
+									selected.append(line[0:line.find(',')]+'\n')
+			# A test listed by several spec versions is built once, tagged with all of them
+			for line in selected:
+				if (line[0:9] not in test_spec_dict):
+					o_f.write(line.strip()+'\n')
+					test_spec_dict[line[0:9]] = 0
+				test_spec_dict[line[0:9]] |= (1 << db_index)
 
 def gen_test_entry_info():
 	"""
@@ -99,21 +146,59 @@ def gen_test_entry_info():
 	uniq_test_string   = ''
 	max_test_per_suite = 200
 	suite_base         = 0
+	test_entries       = []
 
-	if (suite not in suite_with_base_dict.keys()):
-		print("\nProvide a valid SUITE identifier")
-		sys.exit()
+	for suite in suites:
+		if (suite not in suite_with_base_dict.keys()):
+			print("\nProvide a valid SUITE identifier")
+			sys.exit()
 
-	with open(test_entry_list, mode='w') as o_f1, \
-             open(test_entry_fn_declare_list, mode='w') as o_f2,\
-             open(testlist_file, mode='r') as i_f:
+	with open(testlist_file, mode='r') as i_f:
 		for line in i_f:
 			line = line.strip()
-			test_num = int(line[6:9]) + (max_test_per_suite * suite_with_base_dict[suite])
+			suite_base = suite_with_base_dict[test_suite_dict[line[0:9]]]
+			test_num = int(line[6:9]) + (max_test_per_suite * suite_base)
 			uniq_test_string = line[5:9]
+			test_entries.append((test_num, uniq_test_string, test_spec_dict[line[0:9]]))
+
+	# The dispatcher indexes the registry by test ID, which needs it sorted
+	test_entries.sort()
+	with output_file(test_entry_list) as o_f1, \
+             output_file(test_entry_fn_declare_list) as o_f2, \
+             output_file(test_entry_spec_list) as o_f3:
+		for test_num, uniq_test_string, spec_mask in test_entries:
 			o_f1.write("\t{%d, &test_entry_%s},\n" %(test_num, uniq_test_string))
 			o_f2.write("void test_entry_%s(val_api_t *val_api, psa_api_t *psa_api);\n" %(uniq_test_string))
-	print("Non-secure test entry symbol list:\n\t%s,\n\t%s" %(test_entry_list, test_entry_fn_declare_list))
+			o_f3.write("\t0x%x,\n" %(spec_mask))
+	gen_test_entry_index([test_entry[0] for test_entry in test_entries])
+	gen_spec_version_list()
+	print("Non-secure test entry symbol list:\n\t%s,\n\t%s,\n\t%s,\n\t%s,\n\t%s" \
+               %(test_entry_list, test_entry_fn_declare_list, test_entry_index, \
+                 test_entry_spec_list, spec_version_list))
+
+def gen_test_entry_index(test_nums):
+	"""
+	Generate the registry index of the first test whose ID isn't lower than each
+	ID from the first test ID to the last one plus one
+	"""
+	with output_file(test_entry_index) as o_f:
+		if (len(test_nums) == 0):
+			o_f.write("\t0,\n")
+			return
+		index = 0
+		for test_num in range(test_nums[0], test_nums[-1] + 2):
+			while ((index < len(test_nums)) and (test_nums[index] < test_num)):
+				index += 1
+			o_f.write("\t%d,\n" %(index))
+
+def gen_spec_version_list():
+	"""
+	Generate the spec versions of a spec version matrix, in the bit order of the
+	test_entry_spec_list masks
+	"""
+	with output_file(spec_version_list) as o_f:
+		for spec_version in spec_versions:
+			o_f.write("\t\"%s\",\n" %(spec_version))
 
 def gen_secure_tests_list():
 	"""
@@ -123,10 +208,10 @@ def gen_secure_tests_list():
 	test_num_prev = 0
 
 	with open(testlist_file, mode='r') as i_f, \
-	     open(client_tests_list_declare, mode='w') as o_f1, \
-	     open(client_tests_list, mode='w') as o_f2, \
-	     open(server_tests_list_declare, mode='w') as o_f3, \
-	     open(server_tests_list, mode='w') as o_f4:
+	     output_file(client_tests_list_declare) as o_f1, \
+	     output_file(client_tests_list) as o_f2, \
+	     output_file(server_tests_list_declare) as o_f3, \
+	     output_file(server_tests_list) as o_f4:
 		for line in i_f:
 			line = line.strip()
 			o_f1.write("extern client_test_t %s_client_tests_list[];\n" %(line))
@@ -149,5 +234,5 @@ def gen_secure_tests_list():
 # Call routines
 gen_test_list()
 gen_test_entry_info()
-if (suite == "ipc"):
+if ("ipc" in suites):
 	gen_secure_tests_list()
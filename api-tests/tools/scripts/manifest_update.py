@@ -27,7 +27,9 @@ def update_manifest_file(manifest_dir_path):
 	"""
 	file_list =	[manifest_dir_path+"/driver_partition_psa.json",
 				manifest_dir_path+"/client_partition_psa.json",
-				manifest_dir_path+"/server_partition_psa.json"]
+				manifest_dir_path+"/server_partition_psa.json",
+				manifest_dir_path+"/ff_1_1/client_partition_psa.json",
+				manifest_dir_path+"/ff_1_1/server_partition_psa.json"]
 
 	for file in file_list:
 		print("Updating "+file+" manifest file")
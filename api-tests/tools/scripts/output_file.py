@@ -0,0 +1,46 @@
+#!/usr/bin/python
+#/** @file
+# * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+# * SPDX-License-Identifier : Apache-2.0
+# *
+# * Licensed under the Apache License, Version 2.0 (the "License");
+# * you may not use this file except in compliance with the License.
+# * You may obtain a copy of the License at
+# *
+# *  http://www.apache.org/licenses/LICENSE-2.0
+# *
+# * Unless required by applicable law or agreed to in writing, software
+# * distributed under the License is distributed on an "AS IS" BASIS,
+# * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# * See the License for the specific language governing permissions and
+# * limitations under the License.
+#**/
+
+class output_file:
+	"""
+	Output file written on close only when its content changed, which keeps the
+	timestamp of the file and so the objects built from it on a reconfiguration
+	"""
+	def __init__(self, path):
+		self.path  = path
+		self.lines = []
+
+	def __enter__(self):
+		return self
+
+	def write(self, line):
+		self.lines.append(line)
+
+	def __exit__(self, exc_type, exc_value, traceback):
+		if (exc_type is not None):
+			return False
+		content = ''.join(self.lines)
+		try:
+			with open(self.path, mode='r') as i_f:
+				if (i_f.read() == content):
+					return False
+		except IOError:
+			pass
+		with open(self.path, mode='w') as o_f:
+			o_f.write(content)
+		return False
@@ -62,7 +62,7 @@ def generate_source():
 	"""" This method generates the source file which gets compiled on host machine.
 		The compiled output then generates the database file for a given target """
 	try:
-		with open(out_source, mode="a") as o_f:
+		with open(out_source, mode="w") as o_f:
 			o_f.write("#include <stdio.h>\n")
 			o_f.write("#include \"val_target.h\"\n\n")
 			o_f.write("int main (void)\n")
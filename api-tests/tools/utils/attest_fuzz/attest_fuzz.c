@@ -0,0 +1,399 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+/*
+ * Fuzzing harness for the attestation token verifier. Every input is
+ *
+ *   uint8 challenge size | challenge | token
+ *
+ * and goes through val_initial_attest_parse_token(), which reaches the claims
+ * whatever the signature, and through val_initial_attest_verify_token().
+ *
+ * LLVMFuzzerTestOneInput() is the entry point for libFuzzer (and AFL++ with its
+ * libFuzzer driver). Built with ATTEST_FUZZ_LIBFUZZER undefined, the file has
+ * its own main() replaying and mutating a corpus, for AFL and for CI runs.
+ * Every build takes -g <directory> to write the seed corpus.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+
+#include "val_attestation.h"
+
+#define ATTEST_FUZZ_MAX_INPUT_SIZE  (1 + PSA_INITIAL_ATTEST_CHALLENGE_SIZE_64 + \
+                                     PSA_INITIAL_ATTEST_MAX_TOKEN_SIZE)
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    /* Copied so that any overread of the token is caught by the sanitizers */
+    static uint8_t  input[ATTEST_FUZZ_MAX_INPUT_SIZE];
+    uint8_t        *buf;
+    size_t          challenge_size;
+
+    if ((size == 0) || (size > ATTEST_FUZZ_MAX_INPUT_SIZE))
+        return 0;
+
+    challenge_size = data[0];
+    if (challenge_size > size - 1)
+        challenge_size = size - 1;
+
+    buf = malloc(size);
+    if (buf == NULL)
+        return 0;
+    memcpy(buf, data, size);
+    memcpy(input, data, size);
+
+    val_initial_attest_parse_token(buf + 1, challenge_size,
+                                   buf + 1 + challenge_size, size - 1 - challenge_size, 1);
+    val_initial_attest_verify_token(buf + 1, challenge_size,
+                                    buf + 1 + challenge_size, size - 1 - challenge_size);
+
+    /* The verifier only reads the token */
+    if (memcmp(buf, input, size))
+        abort();
+
+    free(buf);
+
+    return 0;
+}
+
+/**
+    @brief    - Writes one seed per test_a001 challenge size, the challenge
+                filled with 0x2a as test_a001 does
+    @param    - path : Corpus directory
+    @return   - 0 on success
+**/
+static int generate_seeds(const char *path)
+{
+    static const size_t challenge_sizes[] = {PSA_INITIAL_ATTEST_CHALLENGE_SIZE_32,
+                                             PSA_INITIAL_ATTEST_CHALLENGE_SIZE_48,
+                                             PSA_INITIAL_ATTEST_CHALLENGE_SIZE_64};
+    uint8_t     input[ATTEST_FUZZ_MAX_INPUT_SIZE];
+    char        file_path[1024];
+    size_t      challenge_size, token_size;
+    uint32_t    i;
+    int32_t     status;
+    FILE       *file;
+
+    mkdir(path, 0755);
+    for (i = 0; i < sizeof(challenge_sizes)/sizeof(challenge_sizes[0]); i++)
+    {
+        challenge_size = challenge_sizes[i];
+        input[0] = (uint8_t)challenge_size;
+        memset(&input[1], 0x2a, challenge_size);
+
+        status = val_attestation_function(VAL_INITIAL_ATTEST_GET_TOKEN, &input[1],
+                                          challenge_size, &input[1 + challenge_size],
+                                          (size_t)PSA_INITIAL_ATTEST_MAX_TOKEN_SIZE, &token_size);
+        if (status != PSA_SUCCESS)
+        {
+            printf("psa_initial_attest_get_token failed %d\n", status);
+            return 1;
+        }
+
+        snprintf(file_path, sizeof(file_path), "%s/a001_challenge_%u", path,
+                 (unsigned int)challenge_size);
+        file = fopen(file_path, "wb");
+        if ((file == NULL) ||
+            (fwrite(input, 1, 1 + challenge_size + token_size, file) !=
+             1 + challenge_size + token_size))
+        {
+            printf("Cannot write %s\n", file_path);
+            if (file != NULL)
+                fclose(file);
+            return 1;
+        }
+        fclose(file);
+    }
+
+    printf("Wrote %u seeds to %s\n", i, path);
+
+    return 0;
+}
+
+/**
+    @brief    - Runs the seed corpus capture of a -g <directory> command line, which
+                every build handles before its fuzzing engine takes the arguments
+    @param    - argc, argv : Command line
+    @return   - -1 without -g, else the exit status of the capture
+**/
+static int seed_command(int argc, char **argv)
+{
+    int arg;
+
+    for (arg = 1; arg + 1 < argc; arg++)
+    {
+        if (!strcmp(argv[arg], "-g"))
+            return generate_seeds(argv[arg + 1]);
+    }
+
+    return -1;
+}
+
+#ifdef ATTEST_FUZZ_LIBFUZZER
+
+int LLVMFuzzerInitialize(int *argc, char ***argv);
+
+/* libFuzzer calls it before parsing its own flags, -g is not one of them */
+int LLVMFuzzerInitialize(int *argc, char ***argv)
+{
+    int status = seed_command(*argc, *argv);
+
+    if (status >= 0)
+        exit(status);
+
+    return 0;
+}
+
+#endif
+
+#ifndef ATTEST_FUZZ_LIBFUZZER
+
+/* Standalone driver */
+
+typedef struct {
+    uint8_t   **inputs;
+    size_t     *sizes;
+    uint32_t    count;
+    uint32_t    capacity;
+} corpus_t;
+
+static void usage(const char *prog)
+{
+    printf("Usage: %s [-n mutations] [-s seed] <corpus file or directory>...\n", prog);
+    printf("       %s -g <corpus directory>\n\n", prog);
+    printf("  -n mutations : Number of mutated inputs run after the corpus, 0 by default\n");
+    printf("  -s seed      : Seed of the mutations, the time by default\n");
+    printf("  -g directory : Write the seed corpus, tokens read from the platform\n");
+    printf("                 attestation service for the test_a001 challenges\n");
+}
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static int corpus_add(corpus_t *corpus, uint8_t *input, size_t size)
+{
+    void *grown;
+
+    if (corpus->count == corpus->capacity)
+    {
+        corpus->capacity = corpus->capacity ? corpus->capacity * 2 : 64;
+        grown = realloc(corpus->inputs, corpus->capacity * sizeof(*corpus->inputs));
+        if (grown == NULL)
+            return 1;
+        corpus->inputs = grown;
+        grown = realloc(corpus->sizes, corpus->capacity * sizeof(*corpus->sizes));
+        if (grown == NULL)
+            return 1;
+        corpus->sizes = grown;
+    }
+
+    corpus->inputs[corpus->count] = input;
+    corpus->sizes[corpus->count]  = size;
+    corpus->count++;
+
+    return 0;
+}
+
+static int corpus_load_file(corpus_t *corpus, const char *path)
+{
+    FILE    *file;
+    uint8_t *input;
+    size_t   size;
+
+    file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        printf("Cannot open %s\n", path);
+        return 1;
+    }
+
+    input = malloc(ATTEST_FUZZ_MAX_INPUT_SIZE);
+    if (input == NULL)
+    {
+        fclose(file);
+        return 1;
+    }
+    size = fread(input, 1, ATTEST_FUZZ_MAX_INPUT_SIZE, file);
+    fclose(file);
+
+    return corpus_add(corpus, input, size);
+}
+
+static int corpus_load(corpus_t *corpus, const char *path)
+{
+    struct stat    st;
+    struct dirent *entry;
+    DIR           *dir;
+    char           file_path[1024];
+    int            status = 0;
+
+    if (stat(path, &st))
+    {
+        printf("Cannot open %s\n", path);
+        return 1;
+    }
+
+    if (!S_ISDIR(st.st_mode))
+        return corpus_load_file(corpus, path);
+
+    dir = opendir(path);
+    if (dir == NULL)
+        return 1;
+
+    while (!status && ((entry = readdir(dir)) != NULL))
+    {
+        if (entry->d_name[0] == '.')
+            continue;
+        snprintf(file_path, sizeof(file_path), "%s/%s", path, entry->d_name);
+        if (!stat(file_path, &st) && S_ISREG(st.st_mode))
+            status = corpus_load_file(corpus, file_path);
+    }
+    closedir(dir);
+
+    return status;
+}
+
+/* Flips, overwrites, inserts or removes a few bytes, the CBOR heads and lengths
+ * included, as a coverage-less stand-in for the libFuzzer mutations
+ */
+static size_t mutate(uint8_t *input, size_t size)
+{
+    static const uint8_t interesting[] = {0x00, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1f,
+                                          0x40, 0x5f, 0x7f, 0x80, 0x9f, 0xa0, 0xbf,
+                                          0xc0, 0xd2, 0xf6, 0xff};
+    uint32_t count = 1 + (uint32_t)rand() % 4, i;
+    size_t   pos;
+
+    for (i = 0; (i < count) && (size > 1); i++)
+    {
+        pos = 1 + (size_t)rand() % (size - 1);
+        switch (rand() % 5)
+        {
+        case 0:
+            input[pos] ^= (uint8_t)(1u << (rand() % 8));
+            break;
+        case 1:
+            input[pos] = interesting[rand() % sizeof(interesting)];
+            break;
+        case 2:
+            input[pos] = (uint8_t)rand();
+            break;
+        case 3:
+            if (size < ATTEST_FUZZ_MAX_INPUT_SIZE)
+            {
+                memmove(&input[pos + 1], &input[pos], size - pos);
+                input[pos] = (uint8_t)rand();
+                size++;
+            }
+            break;
+        default:
+            memmove(&input[pos], &input[pos + 1], size - pos - 1);
+            size--;
+            break;
+        }
+    }
+
+    return size;
+}
+
+int main(int argc, char **argv)
+{
+    corpus_t     corpus = {NULL, NULL, 0, 0};
+    uint8_t      input[ATTEST_FUZZ_MAX_INPUT_SIZE];
+    uint32_t     mutations = 0, i;
+    unsigned int seed = (unsigned int)time(NULL);
+    uint64_t     runs, start, elapsed;
+    size_t       size;
+    int          arg, bad_args = 0, status;
+
+    /* Before AFL owns stdin */
+    status = seed_command(argc, argv);
+    if (status >= 0)
+        return status;
+
+#ifdef __AFL_LOOP
+    /* AFL persistent mode, the input comes on stdin */
+    while (__AFL_LOOP(10000))
+    {
+        size = fread(input, 1, sizeof(input), stdin);
+        LLVMFuzzerTestOneInput(input, size);
+    }
+    return 0;
+#endif
+
+    for (arg = 1; arg < argc; arg++)
+    {
+        if (!strcmp(argv[arg], "-n") && (arg + 1 < argc))
+            mutations = (uint32_t)strtoul(argv[++arg], NULL, 0);
+        else if (!strcmp(argv[arg], "-s") && (arg + 1 < argc))
+            seed = (unsigned int)strtoul(argv[++arg], NULL, 0);
+        else if (argv[arg][0] != '-')
+            bad_args |= corpus_load(&corpus, argv[arg]);
+        else
+            bad_args = 1;
+    }
+
+    if (bad_args || (corpus.count == 0))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    start = now_ns();
+    for (i = 0; i < corpus.count; i++)
+        LLVMFuzzerTestOneInput(corpus.inputs[i], corpus.sizes[i]);
+
+    srand(seed);
+    for (runs = 0; runs < mutations; runs++)
+    {
+        i = (uint32_t)rand() % corpus.count;
+        memcpy(input, corpus.inputs[i], corpus.sizes[i]);
+        size = mutate(input, corpus.sizes[i]);
+        LLVMFuzzerTestOneInput(input, size);
+    }
+    elapsed = now_ns() - start;
+
+    runs += corpus.count;
+    printf("Corpus      : %u\n", corpus.count);
+    printf("Mutations   : %u (seed %u)\n", mutations, seed);
+    printf("Elapsed     : %llu ns\n", (unsigned long long)elapsed);
+    printf("exec/s      : %llu\n",
+           elapsed ? (unsigned long long)(runs * 1000000000ull / elapsed) : 0ull);
+
+    for (i = 0; i < corpus.count; i++)
+        free(corpus.inputs[i]);
+    free(corpus.inputs);
+    free(corpus.sizes);
+
+    return 0;
+}
+
+#endif /* ATTEST_FUZZ_LIBFUZZER */
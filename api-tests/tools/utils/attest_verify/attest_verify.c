@@ -0,0 +1,337 @@
+/** @file
+ * Copyright (c) 2024, Arm Limited or its affiliates. All rights reserved.
+ * SPDX-License-Identifier : Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+**/
+
+/*
+ * Host tool verifying a file of attestation tokens with
+ * val_initial_attest_verify_token_batch(). The file is a sequence of records:
+ *
+ *   uint32 challenge size (little endian) | challenge
+ *   uint32 token size (little endian)     | token
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "val_attestation.h"
+
+#define ATTEST_VERIFY_DEFAULT_THREADS   4
+
+typedef struct {
+    int32_t     status;
+    const char *name;
+} status_name_t;
+
+static const status_name_t status_names[] = {
+    {VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING,      "TOKEN_ERR_CBOR_FORMATTING"},
+    {VAL_ATTEST_TOKEN_CHALLENGE_MISMATCH,       "TOKEN_CHALLENGE_MISMATCH"},
+    {VAL_ATTEST_TOKEN_NOT_SUPPORTED,            "TOKEN_NOT_SUPPORTED"},
+    {VAL_ATTEST_TOKEN_NOT_ALL_MANDATORY_CLAIMS, "TOKEN_NOT_ALL_MANDATORY_CLAIMS"},
+    {VAL_ATTEST_HASH_LENGTH_MISMATCH,           "HASH_LENGTH_MISMATCH"},
+    {VAL_ATTEST_HASH_MISMATCH,                  "HASH_MISMATCH"},
+    {VAL_ATTEST_HASH_FAIL,                      "HASH_FAIL"},
+    {VAL_ATTEST_HASH_UNSUPPORTED,               "HASH_UNSUPPORTED"},
+    {VAL_ATTEST_HASH_BUFFER_SIZE,               "HASH_BUFFER_SIZE"},
+    {VAL_ATTEST_ERR_PROTECTED_HEADERS,          "ERR_PROTECTED_HEADERS"},
+    {VAL_ATTEST_ERR_SIGN_STRUCT,                "ERR_SIGN_STRUCT"},
+    {VAL_ATTEST_ERR_KEY_FAIL,                   "ERR_KEY_FAIL"},
+    {VAL_ATTEST_ERR_SIGNATURE_FAIL,             "ERR_SIGNATURE_FAIL"},
+    {VAL_ATTEST_ERR_CBOR_STRUCTURE,             "ERR_CBOR_STRUCTURE"},
+    {VAL_ATTEST_ERR_SMALL_BUFFER,               "ERR_SMALL_BUFFER"},
+    {VAL_ATTEST_ERROR,                          "ERROR"},
+};
+
+static const char *status_name(int32_t status)
+{
+    uint32_t i;
+
+    for (i = 0; i < sizeof(status_names)/sizeof(status_names[0]); i++)
+    {
+        if (status_names[i].status == status)
+            return status_names[i].name;
+    }
+
+    return "UNKNOWN";
+}
+
+static void usage(const char *prog)
+{
+    printf("Usage: %s [-t threads] [-v] <token file>\n", prog);
+    printf("       %s -g count <token file>\n\n", prog);
+    printf("  -t threads : Number of verifying threads, default %d\n",
+           ATTEST_VERIFY_DEFAULT_THREADS);
+    printf("  -v         : Print the status of every failing token\n");
+    printf("  -g count   : Write count tokens with random challenges, read from\n");
+    printf("               the platform attestation service, to the token file\n");
+}
+
+static int read_u32(const uint8_t *buf, size_t size, size_t *pos, uint32_t *value)
+{
+    if (size - *pos < 4)
+        return 1;
+
+    *value = (uint32_t)buf[*pos] | ((uint32_t)buf[*pos + 1] << 8) |
+             ((uint32_t)buf[*pos + 2] << 16) | ((uint32_t)buf[*pos + 3] << 24);
+    *pos += 4;
+
+    return 0;
+}
+
+static int write_u32(FILE *file, uint32_t value)
+{
+    uint8_t bytes[4];
+
+    bytes[0] = (uint8_t)value;
+    bytes[1] = (uint8_t)(value >> 8);
+    bytes[2] = (uint8_t)(value >> 16);
+    bytes[3] = (uint8_t)(value >> 24);
+
+    return fwrite(bytes, 1, sizeof(bytes), file) != sizeof(bytes);
+}
+
+/**
+    @brief    - Writes count freshly generated tokens to the token file
+    @param    - path  : Token file
+                count : Number of tokens
+    @return   - 0 on success
+**/
+static int generate_tokens(const char *path, uint32_t count)
+{
+    static const size_t challenge_sizes[] = {PSA_INITIAL_ATTEST_CHALLENGE_SIZE_32,
+                                             PSA_INITIAL_ATTEST_CHALLENGE_SIZE_48,
+                                             PSA_INITIAL_ATTEST_CHALLENGE_SIZE_64};
+    uint8_t     challenge[PSA_INITIAL_ATTEST_CHALLENGE_SIZE_64];
+    uint8_t     token[PSA_INITIAL_ATTEST_MAX_TOKEN_SIZE];
+    size_t      challenge_size, token_size;
+    uint32_t    i, j;
+    int32_t     status;
+    FILE       *file;
+
+    file = fopen(path, "wb");
+    if (file == NULL)
+    {
+        printf("Cannot create %s\n", path);
+        return 1;
+    }
+
+    srand((unsigned int)time(NULL));
+    for (i = 0; i < count; i++)
+    {
+        challenge_size = challenge_sizes[i % 3];
+        for (j = 0; j < challenge_size; j++)
+            challenge[j] = (uint8_t)rand();
+
+        status = val_attestation_function(VAL_INITIAL_ATTEST_GET_TOKEN, challenge, challenge_size,
+                                          token, sizeof(token), &token_size);
+        if (status != PSA_SUCCESS)
+        {
+            printf("Token %u: psa_initial_attest_get_token failed %d\n", i, status);
+            fclose(file);
+            return 1;
+        }
+
+        if (write_u32(file, (uint32_t)challenge_size) ||
+            (fwrite(challenge, 1, challenge_size, file) != challenge_size) ||
+            write_u32(file, (uint32_t)token_size) ||
+            (fwrite(token, 1, token_size, file) != token_size))
+        {
+            printf("Cannot write %s\n", path);
+            fclose(file);
+            return 1;
+        }
+    }
+
+    fclose(file);
+    printf("Wrote %u tokens to %s\n", count, path);
+
+    return 0;
+}
+
+/**
+    @brief    - Reads the token file and splits it into batch entries pointing
+                into the file buffer
+    @param    - path       : Token file
+                buf        : Returns the file buffer
+                tokens     : Returns the batch entries
+                num_tokens : Returns the number of entries
+    @return   - 0 on success
+**/
+static int load_tokens(const char *path, uint8_t **buf, val_attest_token_t **tokens,
+                       uint32_t *num_tokens)
+{
+    FILE               *file;
+    long                file_size;
+    size_t              pos = 0, size;
+    uint32_t            count = 0, capacity = 0, field;
+    val_attest_token_t *entries = NULL, *grown;
+
+    file = fopen(path, "rb");
+    if (file == NULL)
+    {
+        printf("Cannot open %s\n", path);
+        return 1;
+    }
+
+    fseek(file, 0, SEEK_END);
+    file_size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    if (file_size <= 0)
+    {
+        printf("%s is empty\n", path);
+        fclose(file);
+        return 1;
+    }
+
+    size = (size_t)file_size;
+    *buf = malloc(size);
+    if ((*buf == NULL) || (fread(*buf, 1, size, file) != size))
+    {
+        printf("Cannot read %s\n", path);
+        fclose(file);
+        return 1;
+    }
+    fclose(file);
+
+    while (pos < size)
+    {
+        if (count == capacity)
+        {
+            capacity = capacity ? capacity * 2 : 256;
+            grown = realloc(entries, capacity * sizeof(*entries));
+            if (grown == NULL)
+            {
+                free(entries);
+                return 1;
+            }
+            entries = grown;
+        }
+
+        if (read_u32(*buf, size, &pos, &field) || (field > size - pos))
+            goto truncated;
+        entries[count].challenge = *buf + pos;
+        entries[count].challenge_size = field;
+        pos += field;
+
+        if (read_u32(*buf, size, &pos, &field) || (field > size - pos))
+            goto truncated;
+        entries[count].token = *buf + pos;
+        entries[count].token_size = field;
+        pos += field;
+
+        entries[count].status = VAL_ATTEST_ERROR;
+        count++;
+    }
+
+    *tokens = entries;
+    *num_tokens = count;
+
+    return 0;
+
+truncated:
+    printf("%s: record %u is truncated\n", path, count);
+    free(entries);
+
+    return 1;
+}
+
+int main(int argc, char **argv)
+{
+    uint32_t                  num_threads = ATTEST_VERIFY_DEFAULT_THREADS;
+    uint32_t                  generate = 0, verbose = 0, num_tokens, i;
+    uint8_t                  *buf = NULL;
+    const char               *path = NULL;
+    val_attest_token_t       *tokens = NULL;
+    val_attest_batch_result_t result;
+    int32_t                   status;
+    int                       arg, bad_args = 0;
+
+    for (arg = 1; arg < argc; arg++)
+    {
+        if (!strcmp(argv[arg], "-t") && (arg + 1 < argc))
+            num_threads = (uint32_t)strtoul(argv[++arg], NULL, 0);
+        else if (!strcmp(argv[arg], "-g") && (arg + 1 < argc))
+            generate = (uint32_t)strtoul(argv[++arg], NULL, 0);
+        else if (!strcmp(argv[arg], "-v"))
+            verbose = 1;
+        else if ((argv[arg][0] != '-') && (path == NULL))
+            path = argv[arg];
+        else
+            bad_args = 1;
+    }
+
+    if (bad_args || (path == NULL) || (num_threads == 0))
+    {
+        usage(argv[0]);
+        return 1;
+    }
+
+    if (generate)
+        return generate_tokens(path, generate);
+
+    if (load_tokens(path, &buf, &tokens, &num_tokens))
+    {
+        free(buf);
+        return 1;
+    }
+
+    status = val_initial_attest_verify_token_batch(tokens, num_tokens, num_threads, &result);
+    if (status != VAL_STATUS_SUCCESS)
+    {
+        printf("Batch verification failed %d\n", status);
+        free(tokens);
+        free(buf);
+        return 1;
+    }
+
+    printf("Tokens      : %u\n", result.num_tokens);
+    printf("Threads     : %u\n", result.num_threads);
+    printf("Passed      : %u\n", result.passed);
+    printf("Failed      : %u\n", result.failed);
+    if (result.elapsed_ns)
+    {
+        printf("Elapsed     : %llu ns\n", (unsigned long long)result.elapsed_ns);
+        printf("Tokens/sec  : %llu\n",
+               (unsigned long long)result.num_tokens * 1000000000ull / result.elapsed_ns);
+    }
+
+    if (result.failed)
+    {
+        printf("Failure reasons:\n");
+        for (i = 0; i < result.num_reasons; i++)
+        {
+            printf("  %-32s (%3d) : %u\n", status_name(result.reasons[i].status),
+                   result.reasons[i].status, result.reasons[i].count);
+        }
+        if (result.other_failures)
+            printf("  %-32s       : %u\n", "OTHER", result.other_failures);
+    }
+
+    if (verbose)
+    {
+        for (i = 0; i < num_tokens; i++)
+        {
+            if (tokens[i].status != VAL_ATTEST_SUCCESS)
+                printf("Token %u: %s (%d)\n", i, status_name(tokens[i].status), tokens[i].status);
+        }
+    }
+
+    free(tokens);
+    free(buf);
+
+    return result.failed ? 2 : 0;
+}
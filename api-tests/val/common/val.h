@@ -313,6 +313,7 @@ typedef enum {
     TEST_ISOLATION_PSA_ROT_HEAP_WR       = 10,
     TEST_ISOLATION_PSA_ROT_MMIO_RD       = 11,
     TEST_ISOLATION_PSA_ROT_MMIO_WR       = 12,
+    TEST_IRQ_LATENCY                     = 13,
 } driver_test_fn_id_t;
 
 /* typedef's */
@@ -142,9 +142,51 @@ void pal_set_custom_test_list(char *custom_test_list);
 **/
 bool_t pal_is_test_enabled(test_id_t test_id);
 
+/**
+ *   @brief    - Returns the spec version whose tests a spec version matrix build runs
+ *   @return   - Spec version, as given to -DSPEC_VERSION, or NULL for the newest one
+**/
+char *pal_get_spec_version(void);
+
 /**
  *   @brief    - initialize anything relavent to a platform
  *   @return   - TRUE/FALSE
 **/
 unsigned int pal_platform_init(void);
+
+/**
+ *   @brief    - Reads a free running timestamp used by benchmark tests
+ *   @param    - timestamp : Returns the current time in nano seconds
+ *   @return   - SUCCESS/FAILURE
+**/
+int pal_get_timestamp_ns(uint64_t *timestamp);
+
+/**
+ *   @brief    - Runs thread_fn concurrently on num_threads threads and waits for
+ *               all of them to return
+ *   @param    - num_threads : Number of threads to run
+ *               thread_fn   : Thread body, called with the thread index and arg
+ *               arg         : Argument passed to every thread
+ *   @return   - SUCCESS/FAILURE
+**/
+int pal_run_threads(uint32_t num_threads, thread_fn_t thread_fn, void *arg);
+
+/**
+ *   @brief    - Runs fn in a separate process and kills that process after
+ *               kill_delay_us micro seconds, as a power loss would
+ *   @param    - fn            : Function to run, called with arg
+ *               arg           : Argument passed to fn
+ *               kill_delay_us : Delay before the kill, zero lets fn run to completion
+ *               completed     : Returns 1 if fn returned before the kill, 0 otherwise
+ *   @return   - SUCCESS/FAILURE
+**/
+int pal_run_killable(killable_fn_t fn, void *arg, uint32_t kill_delay_us, uint32_t *completed);
+
+/**
+ *   @brief    - Runs one case of the memory isolation matrix, catching the fault
+ *   @param    - index    : Case index, from 0
+ *               iso_case : Returns the case and its outcome
+ *   @return   - SUCCESS, PAL_STATUS_ERROR past the last case
+**/
+int pal_isolation_probe(uint32_t index, isolation_case_t *iso_case);
 #endif
@@ -20,12 +20,126 @@
 #include "val_framework.h"
 #include "val_client_defs.h"
 #include "val_attestation.h"
+#include "val_peripherals.h"
+#include "val_platform.h"
 
 #ifdef INITIAL_ATTESTATION
 
-uint32_t    mandatory_claims = 0;
-uint32_t    mandaroty_sw_components = 0;
-bool_t      sw_component_present = 0;
+/* Claims seen in one token. Kept per call so that tokens can be verified concurrently */
+typedef struct {
+    struct q_useful_buf_c challenge;
+    struct q_useful_buf_c profile;             /* Value of the profile claim, if any */
+    uint32_t              claims;              /* CLAIM_BIT() per claim */
+    uint32_t              sw_component_claims; /* Bit label per claim of the first SW component */
+} claims_state_t;
+
+typedef int (*claim_handler_t)(QCBORDecodeContext *decode_context, const QCBORItem *item,
+                               claims_state_t *claims);
+
+typedef struct {
+    int32_t          label;
+    uint8_t          data_type;  /* Expected QCBOR type, QCBOR_TYPE_NONE for any */
+    int              type_error; /* Returned when the type does not match */
+    claim_handler_t  handler;    /* Checks the value, NULL when only the type is checked */
+} claim_desc_t;
+
+/* Claim schema of a token profile, the claims of all profiles share one bitmap */
+typedef struct {
+    const char      *profile;         /* Value of the profile claim */
+    uint32_t         mandatory;       /* Claims with SW components */
+    uint32_t         mandatory_no_sw; /* Claims without SW components, 0 if they are required */
+    uint32_t         sw_mandatory;    /* Claims of the first SW component */
+} claim_schema_t;
+
+static int check_nonce(QCBORDecodeContext *decode_context, const QCBORItem *item,
+                       claims_state_t *claims);
+static int check_profile(QCBORDecodeContext *decode_context, const QCBORItem *item,
+                         claims_state_t *claims);
+static int parse_sw_components(QCBORDecodeContext *decode_context, const QCBORItem *item,
+                               claims_state_t *claims);
+
+/* PSA IoT profile 1 claims, indexed by EAT_CBOR_ARM_RANGE_BASE - label, also their bit */
+static const claim_desc_t arm_claims[EAT_CBOR_ARM_TOTAL_CLAIMS] = {
+    {EAT_CBOR_ARM_LABEL_PROFILE_DEFINITION, QCBOR_TYPE_TEXT_STRING,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, check_profile},
+    {EAT_CBOR_ARM_LABEL_CLIENT_ID,          QCBOR_TYPE_INT64,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, NULL},
+    {EAT_CBOR_ARM_LABEL_SECURITY_LIFECYCLE, QCBOR_TYPE_INT64,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, NULL},
+    {EAT_CBOR_ARM_LABEL_IMPLEMENTATION_ID,  QCBOR_TYPE_BYTE_STRING,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, NULL},
+    {EAT_CBOR_ARM_LABEL_BOOT_SEED,          QCBOR_TYPE_BYTE_STRING,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, NULL},
+    {EAT_CBOR_ARM_LABEL_HW_VERSION,         QCBOR_TYPE_TEXT_STRING,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, NULL},
+    {EAT_CBOR_ARM_LABEL_SW_COMPONENTS,      QCBOR_TYPE_ARRAY,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, parse_sw_components},
+    {EAT_CBOR_ARM_LABEL_NO_SW_COMPONENTS,   QCBOR_TYPE_NONE,
+     VAL_ATTEST_SUCCESS,                   NULL},
+    {EAT_CBOR_ARM_LABEL_NONCE,              QCBOR_TYPE_BYTE_STRING,
+     VAL_ATTEST_TOKEN_NOT_SUPPORTED,       check_nonce},
+    {EAT_CBOR_ARM_LABEL_UEID,               QCBOR_TYPE_BYTE_STRING,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, NULL},
+    {EAT_CBOR_ARM_LABEL_ORIGINATION,        QCBOR_TYPE_TEXT_STRING,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, NULL},
+};
+
+/* EAT and PSA 2.0 / CCA platform claims, sorted by label. Bit EAT_CLAIM_BIT_BASE + index. */
+static const claim_desc_t eat_claims[EAT_CBOR_TOTAL_CLAIMS] = {
+    {EAT_CBOR_LABEL_NONCE,                  QCBOR_TYPE_BYTE_STRING,
+     VAL_ATTEST_TOKEN_NOT_SUPPORTED,       check_nonce},
+    {EAT_CBOR_LABEL_UEID,                   QCBOR_TYPE_BYTE_STRING,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, NULL},
+    {EAT_CBOR_LABEL_PROFILE,                QCBOR_TYPE_TEXT_STRING,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, check_profile},
+    {PSA_CBOR_LABEL_CLIENT_ID,              QCBOR_TYPE_INT64,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, NULL},
+    {PSA_CBOR_LABEL_SECURITY_LIFECYCLE,     QCBOR_TYPE_INT64,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, NULL},
+    {PSA_CBOR_LABEL_IMPLEMENTATION_ID,      QCBOR_TYPE_BYTE_STRING,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, NULL},
+    {PSA_CBOR_LABEL_BOOT_SEED,              QCBOR_TYPE_BYTE_STRING,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, NULL},
+    {PSA_CBOR_LABEL_CERTIFICATION_REF,      QCBOR_TYPE_TEXT_STRING,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, NULL},
+    {PSA_CBOR_LABEL_SW_COMPONENTS,          QCBOR_TYPE_ARRAY,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, parse_sw_components},
+    {PSA_CBOR_LABEL_VERIFICATION_SERVICE,   QCBOR_TYPE_TEXT_STRING,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, NULL},
+    {CCA_CBOR_LABEL_PLATFORM_CONFIG,        QCBOR_TYPE_BYTE_STRING,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, NULL},
+    {CCA_CBOR_LABEL_HASH_ALGO_ID,           QCBOR_TYPE_TEXT_STRING,
+     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING, NULL},
+};
+
+/* Expected types of the SW component claims, indexed by label - EAT_CBOR_SW_COMPONENT_TYPE */
+static const uint8_t sw_component_claims[EAT_CBOR_SW_COMPONENT_TOTAL_CLAIMS] = {
+    QCBOR_TYPE_TEXT_STRING,  /* TYPE */
+    QCBOR_TYPE_BYTE_STRING,  /* MEASUREMENT */
+    QCBOR_TYPE_INT64,        /* EPOCH */
+    QCBOR_TYPE_TEXT_STRING,  /* VERSION */
+    QCBOR_TYPE_BYTE_STRING,  /* SIGNER_ID */
+    QCBOR_TYPE_TEXT_STRING,  /* MEASUREMENT_DESC */
+};
+
+/* Token profiles, the first one applies to tokens without a profile claim */
+static const claim_schema_t claim_schemas[] = {
+    {PSA_IOT_PROFILE_1,    MANDATORY_CLAIM_WITH_SW_COMP, MANDATORY_CLAIM_NO_SW_COMP,
+     MANDATORY_SW_COMP},
+    {PSA_2_0_PROFILE,      MANDATORY_CLAIM_PSA_2_0,      0,
+     MANDATORY_SW_COMP_PSA_2_0},
+    {CCA_PLATFORM_PROFILE, MANDATORY_CLAIM_CCA_PLATFORM, 0,
+     MANDATORY_SW_COMP_PSA_2_0},
+    {PSA_RFC9783_TFM_PROFILE, MANDATORY_CLAIM_PSA_2_0,   0,
+     MANDATORY_SW_COMP_PSA_2_0},
+};
+
+/* Tokens of a batch are handed out to the verifying threads one at a time */
+typedef struct {
+    val_attest_token_t *tokens;
+    uint32_t            num_tokens;
+    uint32_t            next;
+} attest_batch_t;
 
 static int get_items_in_map(QCBORDecodeContext *decode_context,
                             struct items_to_get_t *item_list)
@@ -97,7 +211,7 @@ static int get_item_in_map(QCBORDecodeContext *decode_context,
 }
 
 static int parse_unprotected_headers(QCBORDecodeContext *decode_context,
-                                     struct q_useful_buf_c *child __UNUSED)
+                                     struct q_useful_buf_c *kid)
 {
     struct items_to_get_t   item_list[3];
 
@@ -109,6 +223,11 @@ static int parse_unprotected_headers(QCBORDecodeContext *decode_context,
         return VAL_ATTEST_ERR_CBOR_STRUCTURE;
     }
 
+    /* The kid is optional, the key is then looked up without it */
+    *kid = NULLUsefulBufC;
+    if (item_list[0].item.uDataType == QCBOR_TYPE_BYTE_STRING)
+        *kid = item_list[0].item.val.string;
+
     return VAL_ATTEST_SUCCESS;
 }
 
@@ -141,167 +260,225 @@ static int parse_protected_headers(struct q_useful_buf_c protected_headers,
 }
 
 /**
-    @brief    - This API will verify the claims
-    @param    - decode_context      : The buffer containing the challenge
-                item                : context for decoding the data items
-                completed_challenge : Buffer containing the challenge
+    @brief    - Consumes the items nested in an array or map item, so that a
+                claim of an unknown or unexpected structure is skipped whole
+    @param    - decode_context : context for decoding the data items
+                item           : item that was just decoded
     @return   - error status
 **/
-static int parse_claims(QCBORDecodeContext *decode_context, QCBORItem item,
-                                   struct q_useful_buf_c completed_challenge)
+static int skip_nested_items(QCBORDecodeContext *decode_context, const QCBORItem *item)
 {
-    int i, count = 0, sw_comp_count = 0, index = 0;
-    int status = VAL_ATTEST_SUCCESS;
+    QCBORItem   child;
+    uint32_t    count;
+
+    if ((item->uDataType != QCBOR_TYPE_ARRAY) && (item->uDataType != QCBOR_TYPE_MAP))
+        return VAL_ATTEST_SUCCESS;
 
-    /* Parse each claim and validate their data type */
-    while (status == VAL_ATTEST_SUCCESS)
+    for (count = item->val.uCount; count != 0; count--)
     {
-        status = QCBORDecode_GetNext(decode_context, &item);
-        if (status != VAL_ATTEST_SUCCESS)
-            break;
+        if (QCBORDecode_GetNext(decode_context, &child) != QCBOR_SUCCESS)
+            return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+
+        if (skip_nested_items(decode_context, &child))
+            return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+    }
+
+    return VAL_ATTEST_SUCCESS;
+}
+
+static int check_nonce(QCBORDecodeContext *decode_context, const QCBORItem *item,
+                       claims_state_t *claims)
+{
+    (void)decode_context;
+
+    /* Given challenge vs challenge in token */
+    if (UsefulBuf_Compare(item->val.string, claims->challenge))
+        return VAL_ATTEST_TOKEN_CHALLENGE_MISMATCH;
+
+    return VAL_ATTEST_SUCCESS;
+}
+
+static int check_profile(QCBORDecodeContext *decode_context, const QCBORItem *item,
+                         claims_state_t *claims)
+{
+    (void)decode_context;
+
+    /* The schema is selected once all claims are read */
+    claims->profile = item->val.string;
+
+    return VAL_ATTEST_SUCCESS;
+}
 
-        mandatory_claims |= 1 << (EAT_CBOR_ARM_RANGE_BASE - item.label.int64);
-        if (item.uLabelType == QCBOR_TYPE_INT64)
+static int parse_sw_components(QCBORDecodeContext *decode_context, const QCBORItem *item,
+                               claims_state_t *claims)
+{
+    QCBORItem   component, claim;
+    uint32_t    index, i;
+    int64_t     label;
+
+    for (index = 0; index < item->val.uCount; index++)
+    {
+        if ((QCBORDecode_GetNext(decode_context, &component) != QCBOR_SUCCESS) ||
+            (component.uDataType != QCBOR_TYPE_MAP))
+            return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+
+        for (i = 0; i < component.val.uCount; i++)
         {
-            if (item.label.int64 == EAT_CBOR_ARM_LABEL_NONCE)
-            {
-                if (item.uDataType == QCBOR_TYPE_BYTE_STRING)
-                {
-                    /* Given challenge vs challenge in token */
-                    if (UsefulBuf_Compare(item.val.string, completed_challenge))
-                        return VAL_ATTEST_TOKEN_CHALLENGE_MISMATCH;
-                }
-                else
-                    return VAL_ATTEST_TOKEN_NOT_SUPPORTED;
-            }
-            else if (item.label.int64 == EAT_CBOR_ARM_LABEL_BOOT_SEED ||
-                     item.label.int64 == EAT_CBOR_ARM_LABEL_IMPLEMENTATION_ID ||
-                     item.label.int64 == EAT_CBOR_ARM_LABEL_UEID)
-            {
-                if (item.uDataType != QCBOR_TYPE_BYTE_STRING)
-                    return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
-            }
-            else if (item.label.int64 == EAT_CBOR_ARM_LABEL_ORIGINATION ||
-                     item.label.int64 == EAT_CBOR_ARM_LABEL_PROFILE_DEFINITION ||
-                     item.label.int64 == EAT_CBOR_ARM_LABEL_HW_VERSION)
-            {
-                if (item.uDataType != QCBOR_TYPE_TEXT_STRING)
-                    return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
-            }
-            else if (item.label.int64 == EAT_CBOR_ARM_LABEL_CLIENT_ID ||
-                     item.label.int64 == EAT_CBOR_ARM_LABEL_SECURITY_LIFECYCLE)
+            if (QCBORDecode_GetNext(decode_context, &claim) != QCBOR_SUCCESS)
+                return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+
+            label = claim.label.int64;
+            if ((claim.uLabelType != QCBOR_TYPE_INT64) ||
+                (label < EAT_CBOR_SW_COMPONENT_TYPE) ||
+                (label > EAT_CBOR_SW_COMPONENT_MEASUREMENT_DESC))
             {
-                if (item.uDataType != QCBOR_TYPE_INT64)
+                if (skip_nested_items(decode_context, &claim))
                     return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+                continue;
             }
-            else if (item.label.int64 == EAT_CBOR_ARM_LABEL_SW_COMPONENTS)
-            {
-                if (item.uDataType != QCBOR_TYPE_ARRAY)
-                    return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
 
-                sw_comp_count = item.val.uCount;
-                sw_component_present = 1;
-                for (index = 0; index < sw_comp_count; index++)
-                {
-                    status = QCBORDecode_GetNext(decode_context, &item);
-                    if (status != VAL_ATTEST_SUCCESS)
-                       continue;
-
-                    count = item.val.uCount;
-                    for (i = 0; i <= count; i++)
-                    {
-                        //mandaroty_sw_components |= 1 << item.label.int64;
-                        if (item.label.int64 == EAT_CBOR_SW_COMPONENT_MEASUREMENT)
-                        {
-                           if (index == 0)
-                        	   mandaroty_sw_components |= 1 << item.label.int64;
-                           if (item.uDataType != QCBOR_TYPE_BYTE_STRING)
-                              return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
-                        }
-                        else if (item.label.int64 == EAT_CBOR_SW_COMPONENT_MEASUREMENT_DESC)
-                        {
-                            if (item.uDataType != QCBOR_TYPE_TEXT_STRING)
-                                return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
-                        }
-                        else if (item.label.int64 == EAT_CBOR_SW_COMPONENT_VERSION)
-                        {
-                            if (item.uDataType != QCBOR_TYPE_TEXT_STRING)
-                               return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
-                        }
-                        else if (item.label.int64 == EAT_CBOR_SW_COMPONENT_SIGNER_ID)
-                        {
-                            if (item.uDataType != QCBOR_TYPE_BYTE_STRING)
-                               return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
-                        }
-                        else if (item.label.int64 == EAT_CBOR_SW_COMPONENT_EPOCH)
-                        {
-                             if (item.uDataType != QCBOR_TYPE_INT64)
-                               return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
-                        }
-                        else if (item.label.int64 == EAT_CBOR_SW_COMPONENT_TYPE)
-                        {
-                            if (item.uDataType != QCBOR_TYPE_TEXT_STRING)
-                               return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
-                        }
-
-                        if (i < count)
-                        {
-                            status = QCBORDecode_GetNext(decode_context, &item);
-                            if (status != VAL_ATTEST_SUCCESS)
-                               return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
-                        }
-                    } /*for (i = 0; i <= count; i++)*/
-                } /*for (index = 0; index<sw_comp_count; index++)*/
+            if (claim.uDataType != sw_component_claims[label - EAT_CBOR_SW_COMPONENT_TYPE])
+                return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
 
-            }
+            /* The mandatory claims are checked on the first component */
+            if (index == 0)
+                claims->sw_component_claims |= 1u << label;
+        }
+    }
+
+    return VAL_ATTEST_SUCCESS;
+}
+
+/**
+    @brief    - Looks up the descriptor of a claim in the claim tables
+    @param    - label : Label of the claim
+                bit   : Returns the bit of the claim in the claims bitmap
+    @return   - Claim descriptor, NULL for a claim of no known profile
+**/
+static const claim_desc_t *find_claim(int64_t label, uint32_t *bit)
+{
+    uint32_t index, low = 0, high = EAT_CBOR_TOTAL_CLAIMS, mid;
+
+    /* The label is range checked first, the subtraction could overflow otherwise */
+    if ((label <= EAT_CBOR_ARM_RANGE_BASE) &&
+        (label > (EAT_CBOR_ARM_RANGE_BASE - EAT_CBOR_ARM_TOTAL_CLAIMS)))
+    {
+        index = (uint32_t)(EAT_CBOR_ARM_RANGE_BASE - label);
+        *bit  = index;
+        return &arm_claims[index];
+    }
+
+    while (low < high)
+    {
+        mid = (low + high) / 2;
+        if (eat_claims[mid].label == label)
+        {
+            *bit = EAT_CLAIM_BIT_BASE + mid;
+            return &eat_claims[mid];
         }
+
+        if (eat_claims[mid].label < label)
+            low = mid + 1;
         else
+            high = mid;
+    }
+
+    return NULL;
+}
+
+/**
+    @brief    - This API will verify the claims in a single pass over the
+                payload map, dispatching each claim on its label through the
+                claim tables
+    @param    - decode_context : context for decoding the data items
+                item           : the payload map item
+                claims         : Returns the claims found in the token
+    @return   - error status
+**/
+static int parse_claims(QCBORDecodeContext *decode_context, const QCBORItem *item,
+                        claims_state_t *claims)
+{
+    const claim_desc_t  *desc;
+    QCBORItem            claim;
+    uint32_t             i, bit;
+    int                  status;
+
+    for (i = 0; i < item->val.uCount; i++)
+    {
+        if (QCBORDecode_GetNext(decode_context, &claim) != QCBOR_SUCCESS)
+            return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+
+        desc = (claim.uLabelType == QCBOR_TYPE_INT64) ? find_claim(claim.label.int64, &bit)
+                                                       : NULL;
+        if (desc == NULL)
         {
-            /* For other claim types */
+            /* Claims of no known profile are not checked */
+            if (skip_nested_items(decode_context, &claim))
+                return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+            continue;
         }
+
+        if ((desc->data_type != QCBOR_TYPE_NONE) && (claim.uDataType != desc->data_type))
+            return desc->type_error;
+
+        claims->claims |= 1u << bit;
+
+        status = desc->handler ? desc->handler(decode_context, &claim, claims)
+                               : skip_nested_items(decode_context, &claim);
+        if (status != VAL_ATTEST_SUCCESS)
+            return status;
     }
 
-    if (status == QCBOR_ERR_HIT_END || status == QCBOR_ERR_NO_MORE_ITEMS)
-        return VAL_ATTEST_SUCCESS;
-    else
+    if (QCBORDecode_Finish(decode_context) != QCBOR_SUCCESS)
         return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
+
+    return VAL_ATTEST_SUCCESS;
 }
 
 /**
-    @brief    - This API will verify the attestation token
-    @param    - challenge       : The buffer containing the challenge
-                challenge_size  : Size of the challenge buffer
-                token           : The buffer containing the attestation token
-                token_size      : Size of the token buffer
-    @return   - error status
+    @brief    - Selects the claim schema from the profile claim of the token
+    @param    - profile : Value of the profile claim, NULL pointer if absent
+                strict  : Non-zero to reject an unknown profile, else the PSA IoT
+                          profile 1 schema applies to it
+    @return   - Claim schema, NULL for an unknown profile in strict mode
 **/
-int32_t val_initial_attest_verify_token(uint8_t *challenge, size_t challenge_size,
-                                        uint8_t *token, size_t token_size)
+static const claim_schema_t *find_schema(struct q_useful_buf_c profile, uint32_t strict)
 {
-    int32_t               status = VAL_ATTEST_SUCCESS;
-    int32_t               cose_algorithm_id;
-    QCBORItem             item;
-    QCBORDecodeContext    decode_context;
-    struct q_useful_buf_c completed_challenge;
-    struct q_useful_buf_c completed_token;
-    struct q_useful_buf_c payload;
-    struct q_useful_buf_c signature;
-    struct q_useful_buf_c protected_headers;
-    struct q_useful_buf_c kid;
-    struct q_useful_buf_c token_hash;
+    uint32_t i;
+    size_t   len;
 
-    USEFUL_BUF_MAKE_STACK_UB(buffer_for_encoded_key, MAX_ENCODED_COSE_KEY_SIZE);
-    USEFUL_BUF_MAKE_STACK_UB(buffer_for_token_hash, T_COSE_CRYPTO_SHA256_SIZE);
+    if (profile.ptr == NULL)
+        return &claim_schemas[0];
 
-    kid.ptr = buffer_for_encoded_key.ptr;
+    for (i = 0; i < sizeof(claim_schemas)/sizeof(claim_schemas[0]); i++)
+    {
+        len = strlen(claim_schemas[i].profile);
+        if ((profile.len == len) && !memcmp(profile.ptr, claim_schemas[i].profile, len))
+            return &claim_schemas[i];
+    }
 
-    /* Construct the token buffer for validation */
-    completed_token.ptr = token;
-    completed_token.len = token_size;
+    return strict ? NULL : &claim_schemas[0];
+}
 
-    /* Construct the challenge buffer for validation */
-    completed_challenge.ptr = challenge;
-    completed_challenge.len = challenge_size;
+/**
+    @brief    - Decodes the COSE_Sign1 structure of the token
+    @param    - token             : The attestation token
+                cose_algorithm_id : Returns the signing algorithm
+                protected_headers : Returns the protected headers
+                kid               : Returns the key ID of the unprotected headers, or empty
+                payload           : Returns the payload
+                signature         : Returns the signature
+    @return   - error status
+**/
+static int32_t parse_cose_sign1(struct q_useful_buf_c token, int32_t *cose_algorithm_id,
+                                struct q_useful_buf_c *protected_headers,
+                                struct q_useful_buf_c *kid,
+                                struct q_useful_buf_c *payload,
+                                struct q_useful_buf_c *signature)
+{
+    int32_t               status;
+    QCBORItem             item;
+    QCBORDecodeContext    decode_context;
 
 /*
     -------------------------
@@ -318,7 +495,7 @@ int32_t val_initial_attest_verify_token(uint8_t *challenge, size_t challenge_siz
 */
 
     /* Initialize the decorder */
-    QCBORDecode_Init(&decode_context, completed_token, QCBOR_DECODE_MODE_NORMAL);
+    QCBORDecode_Init(&decode_context, token, QCBOR_DECODE_MODE_NORMAL);
 
     /* Get the Header */
     QCBORDecode_GetNext(&decode_context, &item);
@@ -335,15 +512,15 @@ int32_t val_initial_attest_verify_token(uint8_t *challenge, size_t challenge_siz
     if (item.uDataType != QCBOR_TYPE_BYTE_STRING)
         return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
 
-    protected_headers = item.val.string;
+    *protected_headers = item.val.string;
 
     /* Parse the protected headers and check the data type and value*/
-    status = parse_protected_headers(protected_headers, &cose_algorithm_id);
+    status = parse_protected_headers(*protected_headers, cose_algorithm_id);
     if (status != VAL_ATTEST_SUCCESS)
         return status;
 
     /* Parse the unprotected headers and check the data type and value */
-    status = parse_unprotected_headers(&decode_context, &kid);
+    status = parse_unprotected_headers(&decode_context, kid);
     if (status != VAL_ATTEST_SUCCESS)
         return status;
 
@@ -352,27 +529,39 @@ int32_t val_initial_attest_verify_token(uint8_t *challenge, size_t challenge_siz
     if (item.uDataType != QCBOR_TYPE_BYTE_STRING)
         return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
 
-    payload = item.val.string;
+    *payload = item.val.string;
 
     /* Get the digital signature */
     QCBORDecode_GetNext(&decode_context, &item);
     if (item.uDataType != QCBOR_TYPE_BYTE_STRING)
         return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
 
-    signature = item.val.string;
+    *signature = item.val.string;
 
-    /* Compute the hash from the token */
-    status = val_attestation_function(VAL_INITIAL_ATTEST_COMPUTE_HASH, cose_algorithm_id,
-                                      buffer_for_token_hash, &token_hash,
-                                      protected_headers, payload);
-    if (status != VAL_ATTEST_SUCCESS)
-        return status;
+    return VAL_ATTEST_SUCCESS;
+}
 
-    /* Verify the signature */
-    status = val_attestation_function(VAL_INITIAL_ATTEST_VERIFY_WITH_PK, cose_algorithm_id,
-                                      token_hash, signature);
-    if (status != VAL_ATTEST_SUCCESS)
-        return status;
+/**
+    @brief    - Checks the data type of each claim of the payload and the
+                presence of the mandatory claims of its profile
+    @param    - payload   : The token payload
+                challenge : The challenge the token must carry
+                strict    : Non-zero to reject a token of an unknown profile
+    @return   - error status
+**/
+static int32_t parse_payload(struct q_useful_buf_c payload, struct q_useful_buf_c challenge,
+                             uint32_t strict)
+{
+    int32_t             status;
+    QCBORItem           item;
+    QCBORDecodeContext  decode_context;
+    claims_state_t      claims;
+    const claim_schema_t *schema;
+
+    claims.challenge           = challenge;
+    claims.profile             = NULLUsefulBufC;
+    claims.claims              = 0;
+    claims.sw_component_claims = 0;
 
     /* Initialize the Decoder and validate the payload format */
     QCBORDecode_Init(&decode_context, payload, QCBOR_DECODE_MODE_NORMAL);
@@ -384,23 +573,238 @@ int32_t val_initial_attest_verify_token(uint8_t *challenge, size_t challenge_siz
         return VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING;
 
     /* Parse the payload and check the data type of each claim */
-    status = parse_claims(&decode_context, item, completed_challenge);
+    status = parse_claims(&decode_context, &item, &claims);
     if (status != VAL_ATTEST_SUCCESS)
         return status;
 
-    if ((mandatory_claims & MANDATORY_CLAIM_WITH_SW_COMP) == MANDATORY_CLAIM_WITH_SW_COMP)
+    schema = find_schema(claims.profile, strict);
+    if (schema == NULL)
+        return VAL_ATTEST_TOKEN_NOT_SUPPORTED;
+
+    if ((claims.claims & schema->mandatory) == schema->mandatory)
     {
-        if ((mandaroty_sw_components & MANDATORY_SW_COMP) != MANDATORY_SW_COMP)
+        if ((claims.sw_component_claims & schema->sw_mandatory) != schema->sw_mandatory)
             return VAL_ATTEST_TOKEN_NOT_ALL_MANDATORY_CLAIMS;
-        mandaroty_sw_components = 0;
     }
-    else if ((mandatory_claims & MANDATORY_CLAIM_NO_SW_COMP) != MANDATORY_CLAIM_NO_SW_COMP)
+    else if (!schema->mandatory_no_sw ||
+             ((claims.claims & schema->mandatory_no_sw) != schema->mandatory_no_sw))
     {
         return VAL_ATTEST_TOKEN_NOT_ALL_MANDATORY_CLAIMS;
     }
 
     return VAL_ATTEST_SUCCESS;
 }
+
+/**
+    @brief    - This API will verify the attestation token
+    @param    - challenge       : The buffer containing the challenge
+                challenge_size  : Size of the challenge buffer
+                token           : The buffer containing the attestation token
+                token_size      : Size of the token buffer
+    @return   - error status
+**/
+int32_t val_initial_attest_verify_token(uint8_t *challenge, size_t challenge_size,
+                                        uint8_t *token, size_t token_size)
+{
+    int32_t               status = VAL_ATTEST_SUCCESS;
+    int32_t               cose_algorithm_id;
+    struct q_useful_buf_c completed_challenge;
+    struct q_useful_buf_c completed_token;
+    struct q_useful_buf_c payload;
+    struct q_useful_buf_c signature;
+    struct q_useful_buf_c protected_headers;
+    struct q_useful_buf_c kid;
+    struct q_useful_buf_c token_hash;
+
+    USEFUL_BUF_MAKE_STACK_UB(buffer_for_token_hash, T_COSE_CRYPTO_MAX_HASH_SIZE);
+
+    /* Construct the token buffer for validation */
+    completed_token.ptr = token;
+    completed_token.len = token_size;
+
+    /* Construct the challenge buffer for validation */
+    completed_challenge.ptr = challenge;
+    completed_challenge.len = challenge_size;
+
+    status = parse_cose_sign1(completed_token, &cose_algorithm_id, &protected_headers,
+                              &kid, &payload, &signature);
+    if (status != VAL_ATTEST_SUCCESS)
+        return status;
+
+    /* Compute the hash from the token */
+    status = val_attestation_function(VAL_INITIAL_ATTEST_COMPUTE_HASH, cose_algorithm_id,
+                                      buffer_for_token_hash, &token_hash,
+                                      protected_headers, payload);
+    if (status != VAL_ATTEST_SUCCESS)
+        return status;
+
+    /* Verify the signature */
+    status = val_attestation_function(VAL_INITIAL_ATTEST_VERIFY_WITH_PK, cose_algorithm_id,
+                                      kid, token_hash, signature);
+    if (status != VAL_ATTEST_SUCCESS)
+        return status;
+
+    /* Tokens of a profile unknown to the suite are checked as PSA IoT profile 1 ones */
+    return parse_payload(payload, completed_challenge, 0);
+}
+
+/**
+    @brief    - This API will decode the attestation token and check its
+                claims as val_initial_attest_verify_token() does, without
+                hashing it or verifying its signature
+    @param    - challenge       : The buffer containing the challenge
+                challenge_size  : Size of the challenge buffer
+                token           : The buffer containing the attestation token
+                token_size      : Size of the token buffer
+                strict          : Non-zero to reject a token of an unknown profile,
+                                  else it is checked as a PSA IoT profile 1 one
+    @return   - error status
+**/
+int32_t val_initial_attest_parse_token(uint8_t *challenge, size_t challenge_size,
+                                       uint8_t *token, size_t token_size, uint32_t strict)
+{
+    int32_t               status;
+    int32_t               cose_algorithm_id;
+    struct q_useful_buf_c completed_challenge;
+    struct q_useful_buf_c completed_token;
+    struct q_useful_buf_c payload;
+    struct q_useful_buf_c signature;
+    struct q_useful_buf_c protected_headers;
+    struct q_useful_buf_c kid;
+
+    completed_token.ptr = token;
+    completed_token.len = token_size;
+    completed_challenge.ptr = challenge;
+    completed_challenge.len = challenge_size;
+
+    status = parse_cose_sign1(completed_token, &cose_algorithm_id, &protected_headers,
+                              &kid, &payload, &signature);
+    if (status != VAL_ATTEST_SUCCESS)
+        return status;
+
+    return parse_payload(payload, completed_challenge, strict);
+}
+
+/* Reports a PAL attestation error code as the VAL one of the same failure */
+static int32_t attest_status_from_pal(int32_t status)
+{
+    if ((status >= VAL_ATTEST_PAL_MIN_ERROR) &&
+        (status <= VAL_ATTEST_PAL_MIN_ERROR + VAL_ATTEST_ERROR - VAL_ATTEST_MIN_ERROR))
+        return status - VAL_ATTEST_PAL_MIN_ERROR + VAL_ATTEST_MIN_ERROR;
+
+    return status;
+}
+
+static void attest_batch_worker(uint32_t thread_idx, void *arg)
+{
+    attest_batch_t     *batch = (attest_batch_t *)arg;
+    val_attest_token_t *token;
+    uint32_t            i;
+    int32_t             status;
+
+    (void)thread_idx;
+
+    while ((i = __atomic_fetch_add(&batch->next, 1, __ATOMIC_RELAXED)) < batch->num_tokens)
+    {
+        token = &batch->tokens[i];
+        status = val_initial_attest_verify_token(token->challenge, token->challenge_size,
+                                                 token->token, token->token_size);
+        token->status = attest_status_from_pal(status);
+    }
+}
+
+/**
+    @brief    - This API will verify a batch of attestation tokens, spread over
+                num_threads threads when the platform supports threads. Every
+                verification decodes with its own QCBOR context and shares the
+                attestation public key cached by the PAL.
+    @param    - tokens      : Tokens and their challenges, the status of each
+                              verification is returned in tokens[i].status,
+                              PAL attestation errors as their VAL codes
+                num_tokens  : Number of tokens in the batch
+                num_threads : Number of verifying threads
+                result      : Returns the pass/fail counts, the failure reasons
+                              and the time taken, zero if no timestamp is available
+    @return   - error status of the batch itself, not of the tokens
+**/
+int32_t val_initial_attest_verify_token_batch(val_attest_token_t *tokens, uint32_t num_tokens,
+                                              uint32_t num_threads,
+                                              val_attest_batch_result_t *result)
+{
+    attest_batch_t      batch;
+    uint64_t            start = 0, end = 0;
+    uint32_t            i, j;
+    val_status_t        status;
+
+    if ((tokens == NULL) || (result == NULL) || (num_threads == 0))
+        return VAL_STATUS_INVALID;
+
+    memset(result, 0, sizeof(*result));
+    batch.tokens     = tokens;
+    batch.num_tokens = num_tokens;
+    batch.next       = 0;
+
+    /* The PAL key cache is not locked, import the key for every signing
+     * algorithm before the threads share it, which then only read it. If this
+     * fails every verification reports it, serially.
+     */
+    if (val_attestation_function(VAL_INITIAL_ATTEST_KEY_CACHE_LOAD) != VAL_ATTEST_SUCCESS)
+        num_threads = 1;
+
+    if (val_get_timestamp(&start) != VAL_STATUS_SUCCESS)
+        start = 0;
+
+    status = VAL_STATUS_UNSUPPORTED;
+    if (num_threads > 1)
+        status = val_run_threads(num_threads, attest_batch_worker, &batch);
+
+    if (status == VAL_STATUS_UNSUPPORTED)
+    {
+        num_threads = 1;
+        attest_batch_worker(0, &batch);
+    }
+    else if (status != VAL_STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    if ((start != 0) && (val_get_timestamp(&end) == VAL_STATUS_SUCCESS))
+        result->elapsed_ns = end - start;
+
+    result->num_tokens  = num_tokens;
+    result->num_threads = num_threads;
+
+    for (i = 0; i < num_tokens; i++)
+    {
+        if (tokens[i].status == VAL_ATTEST_SUCCESS)
+        {
+            result->passed++;
+            continue;
+        }
+
+        result->failed++;
+        for (j = 0; j < result->num_reasons; j++)
+        {
+            if (result->reasons[j].status == tokens[i].status)
+                break;
+        }
+
+        if (j == VAL_ATTEST_BATCH_MAX_REASONS)
+        {
+            result->other_failures++;
+            continue;
+        }
+
+        if (j == result->num_reasons)
+        {
+            result->reasons[j].status = tokens[i].status;
+            result->num_reasons++;
+        }
+        result->reasons[j].count++;
+    }
+
+    return VAL_STATUS_SUCCESS;
+}
 #endif /* INITIAL_ATTESTATION */
 
 /**
@@ -416,6 +820,9 @@ int32_t val_attestation_function(int type, ...)
     val_status_t status;
     uint8_t      *challenge, *token;
     size_t       challenge_size, verify_token_size;
+    val_attest_token_t        *tokens;
+    uint32_t                   num_tokens, num_threads;
+    val_attest_batch_result_t *result;
 
     va_start(valist, type);
     switch (type)
@@ -428,6 +835,24 @@ int32_t val_attestation_function(int type, ...)
             status = val_initial_attest_verify_token(challenge, challenge_size,
                                                    token, verify_token_size);
             break;
+        case VAL_INITIAL_ATTEST_PARSE_TOKEN:
+        case VAL_INITIAL_ATTEST_PARSE_TOKEN_STRICT:
+            challenge = va_arg(valist, uint8_t*);
+            challenge_size = va_arg(valist, size_t);
+            token = va_arg(valist, uint8_t*);
+            verify_token_size = va_arg(valist, size_t);
+            status = val_initial_attest_parse_token(challenge, challenge_size,
+                                                   token, verify_token_size,
+                                                   type == VAL_INITIAL_ATTEST_PARSE_TOKEN_STRICT);
+            break;
+        case VAL_INITIAL_ATTEST_VERIFY_TOKEN_BATCH:
+            tokens = va_arg(valist, val_attest_token_t*);
+            num_tokens = va_arg(valist, uint32_t);
+            num_threads = va_arg(valist, uint32_t);
+            result = va_arg(valist, val_attest_batch_result_t*);
+            status = val_initial_attest_verify_token_batch(tokens, num_tokens, num_threads,
+                                                           result);
+            break;
         default:
             status = pal_attestation_function(type, valist);
             break;
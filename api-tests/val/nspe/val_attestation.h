@@ -36,6 +36,7 @@
  */
 #define T_COSE_CRYPTO_EC_P256_COORD_SIZE  32
 #define T_COSE_CRYPTO_SHA256_SIZE         32
+#define T_COSE_CRYPTO_MAX_HASH_SIZE       64  /* SHA-512, for ES512 */
 
 #define MAX_ENCODED_COSE_KEY_SIZE \
    (1 + /* 1 byte to encode map */ \
@@ -62,6 +63,42 @@
 #define EAT_CBOR_ARM_LABEL_ORIGINATION          (EAT_CBOR_ARM_RANGE_BASE - 10)
 
 #define CBOR_ARM_TOTAL_CLAIM_INSTANCE           10
+#define EAT_CBOR_ARM_TOTAL_CLAIMS               11
+
+/* EAT claims and PSA attestation token 2.0 / CCA platform token claims */
+#define EAT_CBOR_LABEL_NONCE                    (10)
+#define EAT_CBOR_LABEL_UEID                     (256)
+#define EAT_CBOR_LABEL_PROFILE                  (265)
+#define PSA_CBOR_LABEL_CLIENT_ID                (2394)
+#define PSA_CBOR_LABEL_SECURITY_LIFECYCLE       (2395)
+#define PSA_CBOR_LABEL_IMPLEMENTATION_ID        (2396)
+#define PSA_CBOR_LABEL_BOOT_SEED                (2397)
+#define PSA_CBOR_LABEL_CERTIFICATION_REF        (2398)
+#define PSA_CBOR_LABEL_SW_COMPONENTS            (2399)
+#define PSA_CBOR_LABEL_VERIFICATION_SERVICE     (2400)
+#define CCA_CBOR_LABEL_PLATFORM_CONFIG          (2401)
+#define CCA_CBOR_LABEL_HASH_ALGO_ID             (2402)
+
+#define EAT_CBOR_TOTAL_CLAIMS                   12
+
+/* Bits of the claims in the claims bitmap, past the EAT_CBOR_ARM_TOTAL_CLAIMS bits */
+#define EAT_CLAIM_BIT_BASE                      16
+#define EAT_CLAIM_NONCE                         (1u << (EAT_CLAIM_BIT_BASE + 0))
+#define EAT_CLAIM_UEID                          (1u << (EAT_CLAIM_BIT_BASE + 1))
+#define EAT_CLAIM_PROFILE                       (1u << (EAT_CLAIM_BIT_BASE + 2))
+#define PSA_CLAIM_CLIENT_ID                     (1u << (EAT_CLAIM_BIT_BASE + 3))
+#define PSA_CLAIM_SECURITY_LIFECYCLE            (1u << (EAT_CLAIM_BIT_BASE + 4))
+#define PSA_CLAIM_IMPLEMENTATION_ID             (1u << (EAT_CLAIM_BIT_BASE + 5))
+#define PSA_CLAIM_SW_COMPONENTS                 (1u << (EAT_CLAIM_BIT_BASE + 8))
+#define CCA_CLAIM_PLATFORM_CONFIG               (1u << (EAT_CLAIM_BIT_BASE + 10))
+#define CCA_CLAIM_HASH_ALGO_ID                  (1u << (EAT_CLAIM_BIT_BASE + 11))
+
+/* Values of the profile claim */
+#define PSA_IOT_PROFILE_1                       "PSA_IOT_PROFILE_1"
+#define PSA_2_0_PROFILE                         "http://arm.com/psa/2.0.0"
+#define CCA_PLATFORM_PROFILE                    "http://arm.com/CCA-SSD/1.0.0"
+/* RFC 9783 profile of TF-M, it carries the claims of the PSA 2.0 profile */
+#define PSA_RFC9783_TFM_PROFILE                 "tag:psacertified.org,2023:psa#tfm"
 
 #define EAT_CBOR_SW_COMPONENT_TYPE              (1u)
 #define EAT_CBOR_SW_COMPONENT_MEASUREMENT       (2u)
@@ -69,6 +106,7 @@
 #define EAT_CBOR_SW_COMPONENT_VERSION           (4u)
 #define EAT_CBOR_SW_COMPONENT_SIGNER_ID         (5u)
 #define EAT_CBOR_SW_COMPONENT_MEASUREMENT_DESC  (6u)
+#define EAT_CBOR_SW_COMPONENT_TOTAL_CLAIMS      6
 
 #define MANDATORY_CLAIM_WITH_SW_COMP           (1 << (EAT_CBOR_ARM_RANGE_BASE                      \
                                                     - EAT_CBOR_ARM_LABEL_NONCE)              |     \
@@ -102,8 +140,33 @@
 
 #define MANDATORY_SW_COMP                      (1 << EAT_CBOR_SW_COMPONENT_MEASUREMENT)
 
+#define MANDATORY_CLAIM_PSA_2_0                (EAT_CLAIM_NONCE                  |     \
+                                                EAT_CLAIM_UEID                   |     \
+                                                EAT_CLAIM_PROFILE                |     \
+                                                PSA_CLAIM_CLIENT_ID              |     \
+                                                PSA_CLAIM_SECURITY_LIFECYCLE     |     \
+                                                PSA_CLAIM_IMPLEMENTATION_ID      |     \
+                                                PSA_CLAIM_SW_COMPONENTS)
+
+#define MANDATORY_CLAIM_CCA_PLATFORM           (EAT_CLAIM_NONCE                  |     \
+                                                EAT_CLAIM_UEID                   |     \
+                                                EAT_CLAIM_PROFILE                |     \
+                                                PSA_CLAIM_SECURITY_LIFECYCLE     |     \
+                                                PSA_CLAIM_IMPLEMENTATION_ID      |     \
+                                                PSA_CLAIM_SW_COMPONENTS          |     \
+                                                CCA_CLAIM_PLATFORM_CONFIG        |     \
+                                                CCA_CLAIM_HASH_ALGO_ID)
+
+#define MANDATORY_SW_COMP_PSA_2_0              (1 << EAT_CBOR_SW_COMPONENT_MEASUREMENT |  \
+                                                1 << EAT_CBOR_SW_COMPONENT_SIGNER_ID)
+
 #define VAL_ATTEST_MIN_ERROR                    70
 
+/* PAL_ATTEST_MIN_ERROR of pal_attestation_eat.h, which cannot be included
+ * alongside this header. The PAL codes follow the same order as the VAL ones.
+ */
+#define VAL_ATTEST_PAL_MIN_ERROR                30
+
 enum attestation_error_code {
     VAL_ATTEST_SUCCESS = 0,
     VAL_ATTEST_TOKEN_ERR_CBOR_FORMATTING = VAL_ATTEST_MIN_ERROR,
@@ -135,10 +198,49 @@ enum attestation_function_code {
     VAL_INITIAL_ATTEST_VERIFY_TOKEN     = 0x3,
     VAL_INITIAL_ATTEST_COMPUTE_HASH     = 0x4,
     VAL_INITIAL_ATTEST_VERIFY_WITH_PK   = 0x5,
+    VAL_INITIAL_ATTEST_KEY_CACHE_INVALIDATE = 0x6,
+    VAL_INITIAL_ATTEST_KEY_CACHE_LOAD   = 0x7,
+    VAL_INITIAL_ATTEST_VERIFY_TOKEN_BATCH = 0x8,
+    VAL_INITIAL_ATTEST_PARSE_TOKEN      = 0x9,
+    VAL_INITIAL_ATTEST_PARSE_TOKEN_STRICT = 0xA,
 };
 
+/* Distinct failure statuses counted by a batch verification */
+#ifndef VAL_ATTEST_BATCH_MAX_REASONS
+#define VAL_ATTEST_BATCH_MAX_REASONS            16
+#endif
+
+typedef struct {
+    uint8_t  *challenge;
+    size_t    challenge_size;
+    uint8_t  *token;
+    size_t    token_size;
+    int32_t   status;
+} val_attest_token_t;
+
+typedef struct {
+    int32_t   status;
+    uint32_t  count;
+} val_attest_reason_t;
+
+typedef struct {
+    uint32_t            num_tokens;
+    uint32_t            num_threads;
+    uint32_t            passed;
+    uint32_t            failed;
+    uint64_t            elapsed_ns;
+    uint32_t            num_reasons;
+    val_attest_reason_t reasons[VAL_ATTEST_BATCH_MAX_REASONS];
+    uint32_t            other_failures;
+} val_attest_batch_result_t;
+
 int32_t val_initial_attest_verify_token(uint8_t *challenge, size_t challenge_size,
                                         uint8_t *token, size_t token_size);
+int32_t val_initial_attest_parse_token(uint8_t *challenge, size_t challenge_size,
+                                       uint8_t *token, size_t token_size, uint32_t strict);
+int32_t val_initial_attest_verify_token_batch(val_attest_token_t *tokens, uint32_t num_tokens,
+                                              uint32_t num_threads,
+                                              val_attest_batch_result_t *result);
 #endif /* INITIAL_ATTESTATION */
 
 int32_t val_attestation_function(int type, ...);
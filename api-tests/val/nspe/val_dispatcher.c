@@ -65,6 +65,101 @@ static val_test_info_t g_test_list[] = {
                                   {VAL_INVALID_TEST_ID, NULL}
                               };
 
+/* The registry is sorted by test ID. Entry i is the registry index of the first
+ * test whose ID isn't lower than the first test ID plus i, up to the last test
+ * ID plus one, so that the successor of a test and the range of a suite are
+ * found without scanning the registry.
+ */
+static const uint16_t g_test_index[] = {
+#include "test_entry_index.inc"
+                                       };
+
+/* Spec versions of a spec version matrix build, none otherwise. Entry i of
+ * g_test_spec_list tells the spec versions test i of the registry applies to,
+ * bit n standing for the n-th one.
+ */
+static const char *const g_spec_versions[] = {
+#include "spec_version_list.inc"
+                                             NULL
+                                         };
+
+static const uint32_t g_test_spec_list[] = {
+#include "test_entry_spec_list.inc"
+                                           0
+                                       };
+
+#define VAL_TEST_LIST_SIZE     (sizeof(g_test_list)/sizeof(g_test_list[0]) - 1)
+#define VAL_TEST_INDEX_SIZE    (sizeof(g_test_index)/sizeof(g_test_index[0]))
+#define VAL_SPEC_VERSION_CNT   (sizeof(g_spec_versions)/sizeof(g_spec_versions[0]) - 1)
+
+/* Spec version run by a spec version matrix build, and its mask */
+static uint32_t g_spec_version_index;
+static uint32_t g_spec_version_mask = ~0U;
+
+/**
+    @brief        - Returns the registry index of the first test whose ID isn't
+                    lower than the given one
+    @param        - test_id : Test ID
+    @return       - Registry index, VAL_TEST_LIST_SIZE past the last test
+**/
+static uint32_t val_test_lower_bound(test_id_t test_id)
+{
+    test_id_t first = g_test_list[0].test_id;
+
+    if ((first == VAL_INVALID_TEST_ID) || (test_id <= first))
+        return 0;
+
+    if ((test_id - first) >= VAL_TEST_INDEX_SIZE)
+        return VAL_TEST_LIST_SIZE;
+
+    return g_test_index[test_id - first];
+}
+
+/* ASCII lower case, spec version names are matched regardless of case */
+#define VAL_SPEC_VERSION_CHAR(c) ((((c) >= 'A') && ((c) <= 'Z')) ? ((c) - 'A' + 'a') : (c))
+
+/**
+    @brief        - Selects the spec version run by a spec version matrix build, the
+                    one returned by the platform or else the newest one. An empty
+                    name is taken as no name.
+    @return       - Error code
+**/
+static val_status_t val_spec_version_select(void)
+{
+    const char *spec_version = pal_get_spec_version();
+    uint32_t    spec_version_cnt = VAL_SPEC_VERSION_CNT;
+    uint32_t    i, j;
+
+    if (spec_version_cnt == 0)
+        return VAL_STATUS_SUCCESS;
+
+    i = spec_version_cnt - 1;
+    if ((spec_version != NULL) && (spec_version[0] != '\0'))
+    {
+        for (i = 0; i < spec_version_cnt; i++)
+        {
+            for (j = 0; (spec_version[j] != '\0') &&
+                        (VAL_SPEC_VERSION_CHAR(spec_version[j]) ==
+                         VAL_SPEC_VERSION_CHAR(g_spec_versions[i][j])); j++)
+                ;
+            if ((spec_version[j] == '\0') && (g_spec_versions[i][j] == '\0'))
+                break;
+        }
+
+        if (i == spec_version_cnt)
+        {
+            val_print(PRINT_ERROR, "\nUnsupported spec version : ", 0);
+            val_print(PRINT_ERROR, spec_version, 0);
+            val_print(PRINT_ERROR, "\n", 0);
+            return VAL_STATUS_INVALID;
+        }
+    }
+
+    g_spec_version_index = i;
+    g_spec_version_mask = 1U << i;
+    return VAL_STATUS_SUCCESS;
+}
+
 /**
     @brief        - This function returns the IDs list of available tests
     @param        - test_id_list : Buffer allocated by caller
@@ -77,7 +172,7 @@ size_t val_get_test_list(uint32_t *test_id_list, size_t size)
 {
 
     val_test_info_t *test_info = &g_test_list[0];
-    size_t test_list_size = sizeof(g_test_list)/sizeof(g_test_list[0]) - 1;
+    size_t test_list_size = VAL_TEST_LIST_SIZE;
 
     if (!test_id_list)
         return test_list_size;
@@ -107,21 +202,16 @@ val_status_t val_test_load(test_id_t *test_id, test_id_t test_id_prev)
 {
     val_test_info_t *test_info = &g_test_list[0];
 
+    /* Successor of the previous test, the remaining tests are only scanned for
+     * the first one enabled on the platform
+     */
     if (test_id_prev != VAL_INVALID_TEST_ID)
-    {
-        for (; test_info->test_id != VAL_INVALID_TEST_ID; test_info++)
-        {
-            if (test_info->test_id == test_id_prev)
-            {
-                test_info++;
-                break;
-            }
-        }
-    }
+        test_info = &g_test_list[val_test_lower_bound(test_id_prev + 1)];
 
     for (; test_info->test_id != VAL_INVALID_TEST_ID; test_info++)
     {
-        if (pal_is_test_enabled(test_info->test_id))
+        if ((g_test_spec_list[test_info - g_test_list] & g_spec_version_mask) &&
+            pal_is_test_enabled(test_info->test_id))
         {
             *test_id = test_info->test_id;
             g_test_info_addr = (addr_t) test_info->entry_addr;
@@ -183,6 +273,37 @@ char *val_get_comp_name(test_id_t test_id)
     }
 }
 
+/**
+    @brief    - Prints the report of a suite from the test counts kept in NVMEM
+    @param    - test_id : ID of a test of the suite
+    @return   - VAL_STATUS_TEST_FAILED when a test of the suite failed, or error code
+**/
+static val_status_t val_report_suite(test_id_t test_id)
+{
+   test_count_t         test_count;
+   val_status_t         status;
+
+   status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_CNT), &test_count, sizeof(test_count_t));
+   if (VAL_ERROR(status))
+   {
+       val_print(PRINT_ERROR, "\n\tNVMEM read error", 0);
+       return status;
+   }
+
+   val_print(PRINT_ALWAYS, "\n************ ", 0);
+   val_print(PRINT_ALWAYS, val_get_comp_name(test_id), 0);
+   val_print(PRINT_ALWAYS, " Report **********\n", 0);
+   val_print(PRINT_ALWAYS, "TOTAL TESTS     : %d\n", test_count.pass_cnt + test_count.fail_cnt
+            + test_count.skip_cnt + test_count.sim_error_cnt);
+   val_print(PRINT_ALWAYS, "TOTAL PASSED    : %d\n", test_count.pass_cnt);
+   val_print(PRINT_ALWAYS, "TOTAL SIM ERROR : %d\n", test_count.sim_error_cnt);
+   val_print(PRINT_ALWAYS, "TOTAL FAILED    : %d\n", test_count.fail_cnt);
+   val_print(PRINT_ALWAYS, "TOTAL SKIPPED   : %d\n", test_count.skip_cnt);
+   val_print(PRINT_ALWAYS, "******************************************\n", 0);
+
+   return (test_count.fail_cnt > 0) ? VAL_STATUS_TEST_FAILED : VAL_STATUS_SUCCESS;
+}
+
 /**
     @brief    - This function is responsible for setting up VAL infrastructure.
                 Loads test one by one from combine binary and calls test_entry
@@ -197,6 +318,13 @@ int32_t val_dispatcher(test_id_t test_id_prev)
     boot_t               boot;
     test_count_t         test_count;
     uint32_t             test_result;
+    uint32_t             suite_failed = 0;
+
+    status = val_spec_version_select();
+    if (VAL_ERROR(status))
+    {
+        return status;
+    }
 
     do
     {
@@ -259,8 +387,35 @@ int32_t val_dispatcher(test_id_t test_id_prev)
 
             if (VAL_GET_COMP_NUM(test_id_prev) != VAL_GET_COMP_NUM(test_id))
             {
+                /* A combined build runs several suites, each one with its own report */
+                if (test_id_prev != VAL_INVALID_TEST_ID)
+                {
+                    status = val_report_suite(test_id_prev);
+                    if (status == VAL_STATUS_TEST_FAILED)
+                        suite_failed = 1;
+                    else if (VAL_ERROR(status))
+                        return status;
+
+                    test_count.pass_cnt = 0;
+                    test_count.fail_cnt = 0;
+                    test_count.skip_cnt = 0;
+                    test_count.sim_error_cnt = 0;
+                    status = val_nvmem_write(VAL_NVMEM_OFFSET(NV_TEST_CNT),
+                                             &test_count, sizeof(test_count_t));
+                    if (VAL_ERROR(status))
+                    {
+                        val_print(PRINT_ERROR, "\n\tNVMEM write error", 0);
+                        return status;
+                    }
+                }
+
                 val_print(PRINT_ALWAYS, "\nRunning.. ", 0);
                 val_print(PRINT_ALWAYS, val_get_comp_name(test_id), 0);
+                if (VAL_SPEC_VERSION_CNT != 0)
+                {
+                    val_print(PRINT_ALWAYS, " for spec version ", 0);
+                    val_print(PRINT_ALWAYS, g_spec_versions[g_spec_version_index], 0);
+                }
 			//	val_print_api_version();
 #ifdef TESTS_COVERAGE
                 val_print(PRINT_ALWAYS, "\nNOTE : Known failing tests are excluded from this \
@@ -332,25 +487,11 @@ build. For PSA functional API certification, all tests must be run.\n", 0);
 
    } while (1);
 
-   status = val_nvmem_read(VAL_NVMEM_OFFSET(NV_TEST_CNT), &test_count, sizeof(test_count_t));
-   if (VAL_ERROR(status))
-   {
-       val_print(PRINT_ERROR, "\n\tNVMEM read error", 0);
-       return status;
-   }
+   status = val_report_suite(test_id_prev);
+   if ((status == VAL_STATUS_SUCCESS) && suite_failed)
+       status = VAL_STATUS_TEST_FAILED;
 
-   val_print(PRINT_ALWAYS, "\n************ ", 0);
-   val_print(PRINT_ALWAYS, val_get_comp_name(test_id_prev), 0);
-   val_print(PRINT_ALWAYS, " Report **********\n", 0);
-   val_print(PRINT_ALWAYS, "TOTAL TESTS     : %d\n", test_count.pass_cnt + test_count.fail_cnt
-            + test_count.skip_cnt + test_count.sim_error_cnt);
-   val_print(PRINT_ALWAYS, "TOTAL PASSED    : %d\n", test_count.pass_cnt);
-   val_print(PRINT_ALWAYS, "TOTAL SIM ERROR : %d\n", test_count.sim_error_cnt);
-   val_print(PRINT_ALWAYS, "TOTAL FAILED    : %d\n", test_count.fail_cnt);
-   val_print(PRINT_ALWAYS, "TOTAL SKIPPED   : %d\n", test_count.skip_cnt);
-   val_print(PRINT_ALWAYS, "******************************************\n", 0);
-
-   return (test_count.fail_cnt > 0) ? VAL_STATUS_TEST_FAILED : VAL_STATUS_SUCCESS;
+   return status;
 }
 
 
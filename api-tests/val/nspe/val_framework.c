@@ -21,12 +21,18 @@
 #include "val_peripherals.h"
 #include "pal_interfaces_ns.h"
 #include "val_target.h"
+#if defined(STORAGE)
+#include "val_storage.h"
+#endif
 
 extern val_api_t val_api;
 extern psa_api_t psa_api;
 
 /* globals */
 test_status_buffer_t    g_status_buffer;
+#if defined(STORAGE) && defined(INCLUDE_BENCHMARK_TESTS)
+static uint32_t         g_storage_test_num;
+#endif
 
 #ifdef IPC
 /**
@@ -569,6 +575,11 @@ void val_test_init(uint32_t test_num, char8_t *desc, uint32_t test_bitfield)
    val_print(PRINT_ALWAYS, "\nTEST: %d | DESCRIPTION: ", test_num);
    val_print(PRINT_ALWAYS, desc, 0);
 
+#if defined(STORAGE) && defined(INCLUDE_BENCHMARK_TESTS)
+   g_storage_test_num = test_num;
+   val_storage_latency_reset();
+#endif
+
    /* common skip logic */
    if (PLATFORM_PSA_ISOLATION_LEVEL < GET_TEST_ISOLATION_LEVEL(test_bitfield))
    {
@@ -619,6 +630,10 @@ void val_test_exit(void)
     }
 #endif
 
+#if defined(STORAGE) && defined(INCLUDE_BENCHMARK_TESTS)
+    val_storage_latency_report(g_storage_test_num);
+#endif
+
     status = val_get_status();
 
     /* return if test skipped or failed */
@@ -23,6 +23,7 @@
 #include "val_crypto.h"
 #include "val_storage.h"
 #include "val_attestation.h"
+#include "val_platform.h"
 
 /*VAL APIs to be used by test */
 const val_api_t val_api = {
@@ -62,6 +63,10 @@ const val_api_t val_api = {
     .crypto_function           = val_crypto_function,
     .storage_function          = val_storage_function,
     .attestation_function      = val_attestation_function,
+    .get_timestamp             = val_get_timestamp,
+    .run_threads               = val_run_threads,
+    .run_killable              = val_run_killable,
+    .isolation_probe           = val_isolation_probe,
 };
 
 const psa_api_t psa_api = {
@@ -62,6 +62,12 @@ typedef struct {
     int32_t          (*crypto_function)           (int type, ...);
     int32_t          (*storage_function)          (int type, ...);
     int32_t          (*attestation_function)      (int type, ...);
+    val_status_t     (*get_timestamp)             (uint64_t *timestamp);
+    val_status_t     (*run_threads)               (uint32_t num_threads,
+                                                   thread_fn_t thread_fn, void *arg);
+    val_status_t     (*run_killable)              (killable_fn_t fn, void *arg,
+                                                   uint32_t kill_delay_us, uint32_t *completed);
+    val_status_t     (*isolation_probe)           (uint32_t index, isolation_case_t *iso_case);
 } val_api_t;
 
 typedef struct {
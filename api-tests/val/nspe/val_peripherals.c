@@ -233,3 +233,23 @@ val_status_t val_nvmem_write(uint32_t offset, const void *buffer, int size)
 
    return pal_nvmem_write_ns(memory_desc->start, offset, buffer, size);
 }
+
+/*
+    @brief     - Reads the platform timestamp used by benchmark tests to measure
+                 API latency.
+               - timestamp : Returns the current time in nano seconds
+    @return    - val_status_t. VAL_STATUS_UNSUPPORTED if the platform has no
+                 timestamp source.
+*/
+val_status_t val_get_timestamp(uint64_t *timestamp)
+{
+   int status;
+
+   status = pal_get_timestamp_ns(timestamp);
+   if (status == PAL_STATUS_UNSUPPORTED_FUNC)
+   {
+        return VAL_STATUS_UNSUPPORTED;
+   }
+
+   return (status == PAL_STATUS_SUCCESS) ? VAL_STATUS_SUCCESS : VAL_STATUS_ERROR;
+}
@@ -28,4 +28,5 @@ val_status_t val_wd_timer_init(wd_timeout_type_t timeout_type);
 val_status_t val_wd_timer_enable(void);
 val_status_t val_wd_timer_disable(void);
 val_status_t val_wd_reprogram_timer(wd_timeout_type_t timeout_type);
+val_status_t val_get_timestamp(uint64_t *timestamp);
 #endif
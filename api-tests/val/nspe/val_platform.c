@@ -27,3 +27,68 @@ val_status_t val_platform_init(void)
 {
     return pal_platform_init();
 }
+
+/**
+    @brief    - Runs thread_fn concurrently on num_threads threads and waits for
+                all of them to return
+    @param    - num_threads : Number of threads to run
+                thread_fn   : Thread body, called with the thread index and arg
+                arg         : Argument passed to every thread
+    @return   - val_status_t. VAL_STATUS_UNSUPPORTED if the platform has no threads.
+**/
+val_status_t val_run_threads(uint32_t num_threads, thread_fn_t thread_fn, void *arg)
+{
+    int status;
+
+    status = pal_run_threads(num_threads, thread_fn, arg);
+    if (status == PAL_STATUS_UNSUPPORTED_FUNC)
+    {
+        return VAL_STATUS_UNSUPPORTED;
+    }
+
+    return (status == PAL_STATUS_SUCCESS) ? VAL_STATUS_SUCCESS : VAL_STATUS_ERROR;
+}
+
+/**
+    @brief    - Runs fn in a separate process and kills that process after
+                kill_delay_us micro seconds, as a power loss would
+    @param    - fn            : Function to run, called with arg
+                arg           : Argument passed to fn
+                kill_delay_us : Delay before the kill, zero lets fn run to completion
+                completed     : Returns 1 if fn returned before the kill, 0 otherwise
+    @return   - val_status_t. VAL_STATUS_UNSUPPORTED if the platform cannot kill a client.
+**/
+val_status_t val_run_killable(killable_fn_t fn, void *arg, uint32_t kill_delay_us,
+                              uint32_t *completed)
+{
+    int status;
+
+    status = pal_run_killable(fn, arg, kill_delay_us, completed);
+    if (status == PAL_STATUS_UNSUPPORTED_FUNC)
+    {
+        return VAL_STATUS_UNSUPPORTED;
+    }
+
+    return (status == PAL_STATUS_SUCCESS) ? VAL_STATUS_SUCCESS : VAL_STATUS_ERROR;
+}
+
+/**
+    @brief    - Runs one case of the memory isolation matrix, an access of a caller
+                to a memory region of an owner, the fault being caught in-process
+    @param    - index    : Case index, from 0
+                iso_case : Returns the case and its outcome
+    @return   - val_status_t. VAL_STATUS_NOT_FOUND past the last case,
+                VAL_STATUS_UNSUPPORTED if the platform cannot recover from a fault.
+**/
+val_status_t val_isolation_probe(uint32_t index, isolation_case_t *iso_case)
+{
+    int status;
+
+    status = pal_isolation_probe(index, iso_case);
+    if (status == PAL_STATUS_UNSUPPORTED_FUNC)
+    {
+        return VAL_STATUS_UNSUPPORTED;
+    }
+
+    return (status == PAL_STATUS_SUCCESS) ? VAL_STATUS_SUCCESS : VAL_STATUS_NOT_FOUND;
+}
@@ -24,5 +24,9 @@
 #include "val_target.h"
 
 val_status_t val_platform_init(void);
+val_status_t val_run_threads(uint32_t num_threads, thread_fn_t thread_fn, void *arg);
+val_status_t val_run_killable(killable_fn_t fn, void *arg, uint32_t kill_delay_us,
+                              uint32_t *completed);
+val_status_t val_isolation_probe(uint32_t index, isolation_case_t *iso_case);
 
 #endif
\ No newline at end of file
@@ -22,6 +22,77 @@
 #include "val_peripherals.h"
 #include "val_storage.h"
 
+#if defined(STORAGE) && defined(INCLUDE_BENCHMARK_TESTS)
+/* Latency of the ITS and PS calls of the running test, indexed by storage_function_code_t.
+ * Updated atomically as tests may call the storage APIs from val->run_threads workers.
+ */
+typedef struct {
+    uint32_t calls;
+    uint64_t total_ns;
+} storage_latency_t;
+
+static storage_latency_t g_storage_latency[2];
+static uint32_t          g_storage_latency_header = FALSE;
+
+/**
+    @brief    - Clears the ITS and PS latency of the previous test
+    @param    - void
+    @return   - void
+**/
+void val_storage_latency_reset(void)
+{
+    memset(g_storage_latency, 0, sizeof(g_storage_latency));
+}
+
+/**
+    @brief    - Prints the ITS and PS latency of the test side by side. Nothing is
+                printed unless the test called both APIs and the platform has a
+                timestamp. The CSV header is printed once per regression.
+    @param    - test_num : Test number the latency belongs to
+    @return   - void
+**/
+void val_storage_latency_report(uint32_t test_num)
+{
+    storage_latency_t *its = &g_storage_latency[VAL_ITS_FUNCTION];
+    storage_latency_t *ps  = &g_storage_latency[VAL_PS_FUNCTION];
+    uint64_t          its_avg, ps_avg;
+
+    if (!its->calls || !ps->calls || !(its->total_ns | ps->total_ns))
+        return;
+
+    its_avg = its->total_ns / its->calls;
+    ps_avg  = ps->total_ns / ps->calls;
+
+    if (g_storage_latency_header == FALSE)
+    {
+        val_print(PRINT_TEST, "\n[Compare] test,its_calls,its_avg_ns,ps_calls,ps_avg_ns,"
+                              "ps_vs_its_pct\n", 0);
+        g_storage_latency_header = TRUE;
+    }
+    val_print(PRINT_TEST, "[Compare] %d,", (int32_t)test_num);
+    val_print(PRINT_TEST, "%d,", (int32_t)its->calls);
+    val_print(PRINT_TEST, "%d,", (its_avg > INT32_MAX) ? INT32_MAX : (int32_t)its_avg);
+    val_print(PRINT_TEST, "%d,", (int32_t)ps->calls);
+    val_print(PRINT_TEST, "%d,", (ps_avg > INT32_MAX) ? INT32_MAX : (int32_t)ps_avg);
+    val_print(PRINT_TEST, "%d\n", its_avg ? (int32_t)((ps_avg * 100) / its_avg) : 0);
+}
+
+static void val_storage_latency_add(storage_function_code_t fCode, uint64_t start)
+{
+    uint64_t end;
+
+    if (val_get_timestamp(&end) != VAL_STATUS_SUCCESS)
+        return;
+    __atomic_fetch_add(&g_storage_latency[fCode].calls, 1, __ATOMIC_RELAXED);
+#if defined(__GCC_ATOMIC_LLONG_LOCK_FREE) && (__GCC_ATOMIC_LLONG_LOCK_FREE == 2)
+    __atomic_fetch_add(&g_storage_latency[fCode].total_ns, end - start, __ATOMIC_RELAXED);
+#else
+    /* No lock-free 64-bit atomics, nor libatomic, on Cortex-M; such targets run no threads */
+    g_storage_latency[fCode].total_ns += end - start;
+#endif
+}
+#endif
+
 /**
     @brief    - This API will call the requested internal trusted storage function
     @param    - type : function code
@@ -33,6 +104,12 @@ int32_t val_storage_function(int type, ...)
 #if defined(STORAGE) || defined(INTERNAL_TRUSTED_STORAGE) || defined(PROTECTED_STORAGE)
     va_list valist;
     int32_t status;
+#if defined(STORAGE) && defined(INCLUDE_BENCHMARK_TESTS)
+    uint64_t start = 0;
+
+    /* Only a combined ITS and PS build has both sides to compare */
+    val_get_timestamp(&start);
+#endif
 
     va_start(valist, type);
     switch (type)
@@ -43,6 +120,9 @@ int32_t val_storage_function(int type, ...)
         case VAL_ITS_GET_INFO:
         case VAL_ITS_REMOVE:
             status = pal_its_function(type, valist);
+#if defined(STORAGE) && defined(INCLUDE_BENCHMARK_TESTS)
+            val_storage_latency_add(VAL_ITS_FUNCTION, start);
+#endif
             break;
 #endif
 #if defined(STORAGE) || defined(PROTECTED_STORAGE)
@@ -54,6 +134,9 @@ int32_t val_storage_function(int type, ...)
         case VAL_PS_SET_EXTENDED:
         case VAL_PS_GET_SUPPORT:
             status = pal_ps_function(type, valist);
+#if defined(STORAGE) && defined(INCLUDE_BENCHMARK_TESTS)
+            val_storage_latency_add(VAL_PS_FUNCTION, start);
+#endif
             break;
 #endif
         default:
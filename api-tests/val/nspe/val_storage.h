@@ -44,5 +44,9 @@ typedef enum {
 } storage_function_code_t;
 
 int32_t val_storage_function(int type, ...);
+#if defined(STORAGE) && defined(INCLUDE_BENCHMARK_TESTS)
+void val_storage_latency_reset(void);
+void val_storage_latency_report(uint32_t test_num);
+#endif
 
 #endif /* _VAL_STORAGE_H_ */
@@ -105,4 +105,12 @@ void pal_generate_interrupt(void);
     @return  - void
 **/
 void pal_disable_interrupt(void);
+
+/**
+    @brief   - Reads a free running timestamp used by the benchmark tests of the
+               secure partitions. Only needed when SP_TIMESTAMP_SUPP is set.
+    @param   - timestamp : Returns the current time in nano seconds
+    @return  - error status 0:SUCCESS, 1:FAIL
+**/
+int  pal_get_timestamp_ns_s(uint64_t *timestamp);
 #endif
@@ -243,3 +243,19 @@ void val_disable_interrupt(void)
 {
     pal_disable_interrupt();
 }
+
+/**
+    @brief   - Reads the driver partition timestamp used to time interrupt delivery
+    @param   - timestamp : Returns the current time in nano seconds, zero when the
+               platform has no secure timestamp
+    @return  - val_status_t
+**/
+val_status_t val_get_timestamp_sf(uint64_t *timestamp)
+{
+#ifdef SP_TIMESTAMP_SUPP
+    if (pal_get_timestamp_ns_s(timestamp) == 0)
+        return VAL_STATUS_SUCCESS;
+#endif
+    *timestamp = 0;
+    return VAL_STATUS_UNSUPPORTED;
+}
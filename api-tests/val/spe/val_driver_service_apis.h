@@ -38,4 +38,5 @@ val_status_t val_init_driver_memory(void);
 val_status_t val_get_driver_mmio_addr(addr_t *base_addr);
 void val_generate_interrupt(void);
 void val_disable_interrupt(void);
+val_status_t val_get_timestamp_sf(uint64_t *timestamp);
 #endif
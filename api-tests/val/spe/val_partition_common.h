@@ -29,6 +29,9 @@
 #include "val.h"
 #include "val_target.c"
 #include "val_service_defs.h"
+#ifdef SP_TIMESTAMP_SUPP
+#include "pal_interfaces_s.h"
+#endif
 
 __UNUSED STATIC_DECLARE val_status_t val_print
                         (print_verbosity_t verbosity, char *string, int32_t data);
@@ -55,6 +58,7 @@ __UNUSED STATIC_DECLARE val_status_t val_err_check_set(uint32_t checkpoint, val_
 __UNUSED STATIC_DECLARE val_status_t val_nvmem_write(uint32_t offset, void *buffer, int size);
 __UNUSED STATIC_DECLARE val_status_t val_set_boot_flag(boot_state_t state);
 __UNUSED STATIC_DECLARE val_status_t val_set_test_data(int32_t nvm_index, int32_t test_data);
+__UNUSED STATIC_DECLARE val_status_t val_get_timestamp(uint64_t *timestamp);
 
 __UNUSED static val_api_t val_api = {
     .print                     = val_print,
@@ -70,6 +74,7 @@ __UNUSED static val_api_t val_api = {
     .process_connect_request   = val_process_connect_request,
     .process_call_request      = val_process_call_request,
     .process_disconnect_request = val_process_disconnect_request,
+    .get_timestamp             = val_get_timestamp,
 };
 
 __UNUSED static psa_api_t psa_api = {
@@ -599,5 +604,22 @@ STATIC_DECLARE val_status_t val_set_test_data(int32_t nvm_index, int32_t test_da
    return status;
 }
 
+/**
+    @brief    - Reads the partition-side timestamp used by benchmark tests to
+                time SPM operations from within a secure partition
+    @param    - timestamp : Returns the current time in nano seconds, zero
+                when the platform has no secure timestamp
+    @return   - val_status_t
+**/
+STATIC_DECLARE val_status_t val_get_timestamp(uint64_t *timestamp)
+{
+#ifdef SP_TIMESTAMP_SUPP
+   if (pal_get_timestamp_ns_s(timestamp) == 0)
+       return VAL_STATUS_SUCCESS;
+#endif
+   *timestamp = 0;
+   return VAL_STATUS_UNSUPPORTED;
+}
+
 
 #endif
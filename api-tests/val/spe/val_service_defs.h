@@ -90,5 +90,6 @@ typedef struct {
   val_status_t (*process_connect_request)    (psa_signal_t sig, psa_msg_t *msg);
   val_status_t (*process_call_request)       (psa_signal_t sig, psa_msg_t *msg);
   val_status_t (*process_disconnect_request) (psa_signal_t sig, psa_msg_t *msg);
+  val_status_t (*get_timestamp)              (uint64_t *timestamp);
 } val_api_t;
 #endif
@@ -39,7 +39,7 @@ foreach(psa_inc_path ${PSA_INCLUDE_PATHS})
         target_include_directories(${PSA_TARGET_VAL_NSPE_LIB} PRIVATE ${psa_inc_path})
 endforeach()
 
-if(${SUITE} STREQUAL "INITIAL_ATTESTATION")
+if("INITIAL_ATTESTATION" IN_LIST PSA_SUITE_LIST)
 target_include_directories(${PSA_TARGET_VAL_NSPE_LIB} PRIVATE
     ${PSA_QCBOR_INCLUDE_PATH}
 )
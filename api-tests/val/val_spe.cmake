@@ -59,6 +59,7 @@ target_include_directories(${PSA_TARGET_DRIVER_PARTITION_LIB} PRIVATE
 	${PSA_ROOT_DIR}/val/spe
 	${PSA_ROOT_DIR}/ff/partition
 	${PSA_ROOT_DIR}/platform/targets/common/nspe
+	${PSA_ROOT_DIR}/platform/targets/common/nspe/crypto
 	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe
 )
 
@@ -73,6 +74,7 @@ target_include_directories(${PSA_TARGET_CLIENT_PARTITION_LIB} PRIVATE
 	${PSA_ROOT_DIR}/val/nspe
 	${PSA_ROOT_DIR}/val/spe
 	${PSA_ROOT_DIR}/platform/targets/common/nspe
+	${PSA_ROOT_DIR}/platform/targets/common/nspe/crypto
 	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe
 	${PSA_ROOT_DIR}/ff/partition
 )
@@ -81,6 +83,7 @@ target_include_directories(${PSA_TARGET_SERVER_PARTITION_LIB} PRIVATE
 	${PSA_ROOT_DIR}/val/common
 	${PSA_ROOT_DIR}/val/spe
 	${PSA_ROOT_DIR}/platform/targets/common/nspe
+	${PSA_ROOT_DIR}/platform/targets/common/nspe/crypto
 	${PSA_ROOT_DIR}/platform/targets/${TARGET}/nspe
 	${PSA_ROOT_DIR}/ff/partition
 )